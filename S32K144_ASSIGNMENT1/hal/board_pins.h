@@ -0,0 +1,85 @@
+/**
+ * @file board_pins.h
+ * @brief Bảng mô tả chân của board, nguồn duy nhất cho pin ảo, bảng s_pinMap và các hàm truy cập inline.
+ * @details Mỗi dòng của BOARD_PIN_TABLE là X(tên, port, chân) với port là chữ cái A đến E.
+ * Từ bảng này sinh ra:
+ * - Pin ảo PIN_<tên>, đánh số theo thứ tự trong bảng, dùng cho HAL_GPIO_* và ARM_DRIVER_GPIO.
+ * - Bảng s_pinMap và bảng tra ngược (port, chân) sang pin ảo trong hal_gpio.c.
+ * - Các hàm BOARD_<tên>_Set/Clear/Toggle/Write/Read, với địa chỉ và mặt nạ là hằng số
+ *   nên mỗi hàm chỉ còn một lần ghi (hoặc đọc) thanh ghi, không kiểm tra chỉ số và không tra bảng.
+ *
+ * @author Nguyen Vuong Trung Nam
+ * @date Oct 17, 2026
+ */
+
+#ifndef BOARD_PINS_H_
+#define BOARD_PINS_H_
+
+#include "stdint.h"
+#include "S32K144.h"
+
+/*******************************************************************************
+ * Board table
+ ******************************************************************************/
+
+#define BOARD_PIN_TABLE(X) \
+    X(BUTTON1,   E,  4U) \
+    X(BUTTON2,   E,  5U) \
+    X(LED_RED,   D, 15U) \
+    X(LED_GREEN, D, 16U)
+
+/*******************************************************************************
+ * Generated definitions
+ ******************************************************************************/
+
+/**
+ * @brief Pin ảo của board.
+ */
+#define BOARD_PIN_ENUM(name, port, pin)     PIN_##name,
+typedef enum
+{
+    BOARD_PIN_TABLE(BOARD_PIN_ENUM)
+    BOARD_PIN_COUNT
+} board_pin_t;
+#undef BOARD_PIN_ENUM
+
+/**
+ * @brief Phần tử của s_pinMap (pin_map_t) cho một dòng của bảng.
+ */
+#define BOARD_PIN_MAP_ENTRY(name, port, pin) \
+    [PIN_##name] = {IP_PORT##port, IP_PT##port, (pin), PCC_PORT##port##_INDEX, PORT##port##_IRQn},
+
+/**
+ * @brief Chỉ số của các port, dùng cho bảng tra ngược.
+ */
+#define BOARD_PORT_INDEX_A          0U
+#define BOARD_PORT_INDEX_B          1U
+#define BOARD_PORT_INDEX_C          2U
+#define BOARD_PORT_INDEX_D          3U
+#define BOARD_PORT_INDEX_E          4U
+
+/**
+ * @brief Phần tử của bảng tra ngược cho một dòng của bảng, lưu pin ảo cộng 1
+ * để các chân không có trong bảng (giá trị 0) được phân biệt với pin ảo 0.
+ */
+#define BOARD_PIN_REVERSE_ENTRY(name, port, pin) \
+    [BOARD_PORT_INDEX_##port][(pin)] = (uint8_t)(PIN_##name + 1U),
+
+/**
+ * @brief Hàm truy cập inline cho từng pin, dùng khi pin đã biết lúc biên dịch.
+ */
+#define BOARD_PIN_ACCESSORS(name, port, pin) \
+    static inline void BOARD_##name##_Set(void)     { IP_PT##port->PSOR = (1UL << (pin)); } \
+    static inline void BOARD_##name##_Clear(void)   { IP_PT##port->PCOR = (1UL << (pin)); } \
+    static inline void BOARD_##name##_Toggle(void)  { IP_PT##port->PTOR = (1UL << (pin)); } \
+    static inline void BOARD_##name##_Write(uint32_t value) \
+    { \
+        if (value) { IP_PT##port->PSOR = (1UL << (pin)); } \
+        else       { IP_PT##port->PCOR = (1UL << (pin)); } \
+    } \
+    static inline uint32_t BOARD_##name##_Read(void) { return (IP_PT##port->PDIR >> (pin)) & 1UL; }
+
+BOARD_PIN_TABLE(BOARD_PIN_ACCESSORS)
+#undef BOARD_PIN_ACCESSORS
+
+#endif /* BOARD_PINS_H_ */
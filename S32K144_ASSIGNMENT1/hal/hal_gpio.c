@@ -1,23 +1,41 @@
 #include "hal_gpio.h"
-#include "my_nvic.h" /* Giả sử file này chứa định nghĩa NVIC */
+#include "hal_irq.h"
 
 /*******************************************************************************
  * Definitions
  ******************************************************************************/
 
-/* Định nghĩa các pin ảo được sử dụng trong dự án */
-#define PIN_BUTTON1             0U
-#define PIN_BUTTON2             1U
-#define PIN_LED_RED             2U
-#define PIN_LED_GREEN           3U
+/* Các pin ảo PIN_* được sinh từ BOARD_PIN_TABLE trong board_pins.h */
 
 /* Tổng số pin ảo được quản lý bởi HAL */
 #define HAL_VIRTUAL_PIN_COUNT   (sizeof(s_pinMap) / sizeof(pin_map_t))
 
+/* Giá trị IRQC: tắt ngắt và ngắt ở cả hai cạnh */
+#define HAL_GPIO_IRQC_DISABLED      0U
+#define HAL_GPIO_IRQC_EITHER_EDGE   11U
+
+/**
+ * @brief Trạng thái lọc nhiễu của một port, mỗi bit ứng với một chân vật lý.
+ * Bộ đếm dọc 2-bit (cnt1:cnt0) đếm số mẫu liên tiếp khác trạng thái đã lọc cho
+ * 32 chân cùng lúc, một lần đọc PDIR cho cả port.
+ */
+typedef struct
+{
+    uint32_t mask;          /* Các chân có lọc nhiễu */
+    uint32_t invert;        /* Các chân tích cực mức thấp */
+    uint32_t stable;        /* Trạng thái đã lọc, 1 = đang nhấn */
+    uint32_t cnt0;          /* Bit thấp của bộ đếm dọc */
+    uint32_t cnt1;          /* Bit cao của bộ đếm dọc */
+    uint32_t active;        /* Các chân đang được lấy mẫu (ngắt cạnh đang tắt) */
+    uint32_t holding;       /* Các chân đang nhấn, chưa báo nhấn giữ */
+} hal_gpio_debounce_t;
+
 /*******************************************************************************
  * Prototypes
  ******************************************************************************/
-/* Không có hàm static nội bộ */
+static void HAL_GPIO_DispatchPort(uint32_t port_index, PORT_Type *port, const GPIO_Type *gpio);
+static void HAL_GPIO_SetIrqc(PORT_Type *port, uint32_t pins, uint32_t irqc_value);
+static void HAL_GPIO_DebouncePort(uint32_t port_index);
 
 /*******************************************************************************
  * Variables
@@ -27,18 +45,42 @@
  * @brief Bảng ánh xạ từ pin ảo sang thông tin phần cứng.
  */
 static const pin_map_t s_pinMap[] = {
-    [PIN_BUTTON1]   = {IP_PORTE, IP_PTE,  4U, PCC_PORTE_INDEX, PORTE_IRQn},
-    [PIN_BUTTON2]   = {IP_PORTE, IP_PTE,  5U, PCC_PORTE_INDEX, PORTE_IRQn},
-    [PIN_LED_RED]   = {IP_PORTD, IP_PTD, 15U, PCC_PORTD_INDEX, PORTD_IRQn},
-    [PIN_LED_GREEN] = {IP_PORTD, IP_PTD, 16U, PCC_PORTD_INDEX, PORTD_IRQn}
+    BOARD_PIN_TABLE(BOARD_PIN_MAP_ENTRY)
+};
+
+/**
+ * @brief Bảng tra ngược từ (port, chân vật lý) sang pin ảo cộng 1, 0 nếu chân không được quản lý.
+ * Được sinh lúc biên dịch từ cùng bảng với s_pinMap, ISR không phải duyệt s_pinMap.
+ */
+static const uint8_t s_pinReverseMap[HAL_GPIO_PORT_COUNT][32] = {
+    BOARD_PIN_TABLE(BOARD_PIN_REVERSE_ENTRY)
 };
 
+/**
+ * @brief Loại trigger đã cấu hình cho từng pin ảo, dùng để báo sự kiện trong ISR.
+ */
+static uint8_t s_pinTrigger[sizeof(s_pinMap) / sizeof(pin_map_t)];
+
 /**
  * @brief Mảng lưu trữ các con trỏ hàm callback.
  * Khai báo là 'static' để bảo vệ dữ liệu, chỉ truy cập qua API.
  */
 static HAL_GPIO_Callback_t s_gpioCallbacks[sizeof(s_pinMap) / sizeof(pin_map_t)];
 
+/**
+ * @brief Thanh ghi PORT và GPIO theo chỉ số port (BOARD_PORT_INDEX_*), dùng trong ISR của nhịp lọc nhiễu.
+ */
+static PORT_Type * const s_portBase[HAL_GPIO_PORT_COUNT] = { IP_PORTA, IP_PORTB, IP_PORTC, IP_PORTD, IP_PORTE };
+static GPIO_Type * const s_gpioBase[HAL_GPIO_PORT_COUNT] = { IP_PTA, IP_PTB, IP_PTC, IP_PTD, IP_PTE };
+
+/**
+ * @brief Trạng thái lọc nhiễu của từng port và số nhịp đã giữ của từng pin ảo.
+ */
+static hal_gpio_debounce_t s_debounce[HAL_GPIO_PORT_COUNT];
+static uint32_t s_pinHoldTicks[sizeof(s_pinMap) / sizeof(pin_map_t)];
+static uint32_t s_longPressTicks = 0U;
+static bool s_debounceReady = false;
+
 
 /*******************************************************************************
  * Code
@@ -124,6 +166,112 @@ void HAL_GPIO_WritePin(uint32_t virtual_pin, bool value)
     }
 }
 
+bool HAL_GPIO_InitGroup(hal_gpio_group_t *group, const uint32_t *virtual_pins, uint32_t count)
+{
+    bool retVal = true;
+    GPIO_Type * gpio = NULL;
+    uint32_t i = 0U;
+    uint32_t port = 0U;
+
+    if ((NULL == group) || (NULL == virtual_pins) || (0U == count) || (count > HAL_GPIO_GROUP_MAX_PINS))
+    {
+        retVal = false;
+    }
+    else
+    {
+        group->pin_count = 0U;
+        group->port_count = 0U;
+
+        for (i = 0U; (i < count) && (true == retVal); i++)
+        {
+            if (virtual_pins[i] >= HAL_VIRTUAL_PIN_COUNT)
+            {
+                retVal = false;
+            }
+            else
+            {
+                gpio = s_pinMap[virtual_pins[i]].gpio_base;
+
+                /* Tìm port trong nhóm, thêm mới nếu chưa có */
+                for (port = 0U; (port < group->port_count) && (group->gpio_base[port] != gpio); port++)
+                {
+                    /* Do nothing */
+                }
+
+                if (port == group->port_count)
+                {
+                    group->gpio_base[port] = gpio;
+                    group->port_count++;
+                }
+                else
+                {
+                    /* Do nothing */
+                }
+
+                group->port_index[i] = (uint8_t)port;
+                group->pin_mask[i] = (1UL << s_pinMap[virtual_pins[i]].pin_num);
+                group->pin_count++;
+            }
+        }
+    }
+
+    return retVal;
+}
+
+void HAL_GPIO_WriteGroup(const hal_gpio_group_t *group, uint32_t mask, uint32_t values)
+{
+    uint32_t setMask[HAL_GPIO_PORT_COUNT] = {0U};
+    uint32_t clearMask[HAL_GPIO_PORT_COUNT] = {0U};
+    uint32_t i = 0U;
+    uint32_t irqState = 0U;
+    GPIO_Type * gpio = NULL;
+
+    if (NULL != group)
+    {
+        /* Gom các pin theo port */
+        for (i = 0U; i < group->pin_count; i++)
+        {
+            if ((mask & (1UL << i)) != 0U)
+            {
+                if ((values & (1UL << i)) != 0U)
+                {
+                    setMask[group->port_index[i]] |= group->pin_mask[i];
+                }
+                else
+                {
+                    clearMask[group->port_index[i]] |= group->pin_mask[i];
+                }
+            }
+        }
+
+        /* Mỗi port một lần ghi */
+        for (i = 0U; i < group->port_count; i++)
+        {
+            gpio = group->gpio_base[i];
+
+            if ((setMask[i] != 0U) && (clearMask[i] != 0U))
+            {
+                /* Đọc-sửa-ghi PDOR trong critical section để ISR khác ghi cùng port không bị mất */
+                HAL_IRQ_ENTER_CRITICAL(irqState);
+                gpio->PDOR = (gpio->PDOR & ~clearMask[i]) | setMask[i];
+                HAL_IRQ_EXIT_CRITICAL(irqState);
+            }
+            else if (setMask[i] != 0U)
+            {
+                gpio->PSOR = setMask[i];
+            }
+            else if (clearMask[i] != 0U)
+            {
+                gpio->PCOR = clearMask[i];
+            }
+            else
+            {
+                /* Do nothing */
+            }
+        }
+    }
+}
+
 void HAL_GPIO_TogglePin(uint32_t virtual_pin)
 {
     if (virtual_pin < HAL_VIRTUAL_PIN_COUNT)
@@ -240,6 +388,8 @@ void HAL_GPIO_SetEventTrigger(uint32_t virtual_pin, hal_gpio_interrupt_trigger_t
                 break;
         }
 
+        s_pinTrigger[virtual_pin] = (uint8_t)trigger;
+
         pcr_val = port->PCR[physical_pin] & ~PORT_PCR_IRQC_MASK;
         pcr_val |= PORT_PCR_IRQC(irqc_value);
         port->PCR[physical_pin] = pcr_val;
@@ -248,11 +398,11 @@ void HAL_GPIO_SetEventTrigger(uint32_t virtual_pin, hal_gpio_interrupt_trigger_t
 
         if (trigger != HAL_GPIO_TRIGGER_NONE)
         {
-            NVIC->ISER[(uint32_t)s_pinMap[virtual_pin].irq_num >> 5U] = (1UL << ((uint32_t)s_pinMap[virtual_pin].irq_num & 0x1FUL));
+            HAL_IRQ_Enable(s_pinMap[virtual_pin].irq_num);
         }
         else
         {
-            NVIC->ICER[(uint32_t)s_pinMap[virtual_pin].irq_num >> 5U] = (1UL << ((uint32_t)s_pinMap[virtual_pin].irq_num & 0x1FUL));
+            HAL_IRQ_Disable(s_pinMap[virtual_pin].irq_num);
         }
     }
 }
@@ -281,25 +431,362 @@ void HAL_GPIO_ClearInterruptFlag(uint32_t virtual_pin)
     }
 }
 
-void PORTE_IRQHandler(void)
+bool HAL_GPIO_DebounceInit(uint32_t cycles_per_us, uint32_t tick_us, uint32_t long_press_ticks)
+{
+    bool retVal = true;
+    uint32_t i = 0U;
+
+    if ((0U == tick_us) || (0U == cycles_per_us) || (tick_us > (0xFFFFFFFFUL / cycles_per_us)))
+    {
+        retVal = false;
+    }
+    else
+    {
+        for (i = 0U; i < HAL_GPIO_PORT_COUNT; i++)
+        {
+            s_debounce[i].mask = 0U;
+            s_debounce[i].invert = 0U;
+            s_debounce[i].stable = 0U;
+            s_debounce[i].cnt0 = 0xFFFFFFFFUL;
+            s_debounce[i].cnt1 = 0xFFFFFFFFUL;
+            s_debounce[i].active = 0U;
+            s_debounce[i].holding = 0U;
+        }
+
+        s_longPressTicks = long_press_ticks;
+
+        /* Kênh đếm xuống tuần hoàn, chỉ được bật khi có chân đang thay đổi */
+        IP_LPIT0->CLRTEN = LPIT_CLRTEN_CLR_T_EN_0_MASK;
+        IP_LPIT0->TMR[HAL_GPIO_DEBOUNCE_CHANNEL].TCTRL = LPIT_TMR_TCTRL_MODE(0);
+        IP_LPIT0->TMR[HAL_GPIO_DEBOUNCE_CHANNEL].TVAL = (tick_us * cycles_per_us) - 1U;
+        IP_LPIT0->MSR = LPIT_MSR_TIF0_MASK;
+        IP_LPIT0->MIER |= LPIT_MIER_TIE0_MASK;
+        HAL_IRQ_Enable(LPIT0_Ch0_IRQn);
+
+        s_debounceReady = true;
+    }
+
+    return retVal;
+}
+
+bool HAL_GPIO_EnableDebounce(uint32_t virtual_pin, bool active_low)
+{
+    bool retVal = true;
+    PORT_Type * port = NULL;
+    hal_gpio_debounce_t * db = NULL;
+    uint32_t port_index = 0U;
+    uint32_t pin_mask = 0U;
+    uint32_t dfer = 0U;
+    uint32_t irqState = 0U;
+
+    if ((virtual_pin >= HAL_VIRTUAL_PIN_COUNT) || (false == s_debounceReady))
+    {
+        retVal = false;
+    }
+    else
+    {
+        port = s_pinMap[virtual_pin].port_base;
+        pin_mask = (1UL << s_pinMap[virtual_pin].pin_num);
+
+        for (port_index = 0U; s_portBase[port_index] != port; port_index++)
+        {
+            /* Do nothing */
+        }
+
+        db = &s_debounce[port_index];
+
+        /* Bộ lọc số của PORT: DFCR và DFWR chỉ được đổi khi bộ lọc của cả port đang tắt */
+        dfer = port->DFER;
+        port->DFER = 0U;
+        port->DFCR = PORT_DFCR_CS(1U);
+        port->DFWR = PORT_DFWR_FILT(HAL_GPIO_DIGITAL_FILTER_WIDTH);
+        port->DFER = dfer | pin_mask;
+
+        HAL_IRQ_ENTER_CRITICAL(irqState);
+
+        if (active_low)
+        {
+            db->invert |= pin_mask;
+        }
+        else
+        {
+            db->invert &= ~pin_mask;
+        }
+
+        /* Trạng thái ban đầu lấy theo mức hiện tại, không báo sự kiện */
+        db->stable = (db->stable & ~pin_mask) | ((s_pinMap[virtual_pin].gpio_base->PDIR ^ db->invert) & pin_mask);
+        db->cnt0 |= pin_mask;
+        db->cnt1 |= pin_mask;
+        db->holding &= ~pin_mask;
+        db->mask |= pin_mask;
+
+        HAL_IRQ_EXIT_CRITICAL(irqState);
+
+        /* Ngắt cạnh chỉ dùng để đánh thức nhịp lấy mẫu */
+        HAL_GPIO_SetEventTrigger(virtual_pin, HAL_GPIO_TRIGGER_EITHER_EDGE);
+    }
+
+    return retVal;
+}
+
+/**
+ * @brief Xử lý ngắt chung của một port.
+ * Đọc ISFR một lần, xóa tất cả các cờ đã đọc bằng một lần ghi, rồi duyệt các bit được set
+ * bằng CLZ. Thời gian xử lý chỉ phụ thuộc số chân có cờ, không phụ thuộc số chân được cấu hình.
+ *
+ * @param port_index Chỉ số port (BOARD_PORT_INDEX_*).
+ * @param port Thanh ghi PORT của port.
+ * @param gpio Thanh ghi GPIO của port, dùng để xác định cạnh khi trigger là cả hai cạnh.
+ */
+static void HAL_GPIO_DispatchPort(uint32_t port_index, PORT_Type *port, const GPIO_Type *gpio)
 {
-    if (HAL_GPIO_IsInterruptFlagSet(PIN_BUTTON1))
+    uint32_t flags = port->ISFR;
+    uint32_t debounced = flags & s_debounce[port_index].mask;
+    uint32_t physical_pin = 0U;
+    uint32_t virtual_pin = 0U;
+    uint32_t event = 0U;
+    uint32_t irqState = 0U;
+
+    /* Xóa trước khi gọi callback để cạnh mới xảy ra trong callback vẫn được ghi nhận */
+    port->ISFR = flags;
+
+    /*
+     * Chân có lọc nhiễu: tắt ngắt cạnh cho đến khi chân ổn định để dội phím không gây
+     * chuỗi ngắt liên tục, sự kiện nhấn/nhả do nhịp LPIT báo.
+     * Nhịp LPIT (HAL_IRQ_PRIO_TIMER) ưu tiên cao hơn ngắt PORT và cũng xóa bit trong
+     * active, nên phép đọc-sửa-ghi được che bằng critical section.
+     */
+    if (debounced != 0U)
+    {
+        HAL_IRQ_ENTER_CRITICAL(irqState);
+        HAL_GPIO_SetIrqc(port, debounced, HAL_GPIO_IRQC_DISABLED);
+        s_debounce[port_index].active |= debounced;
+        IP_LPIT0->SETTEN = LPIT_SETTEN_SET_T_EN_0_MASK;
+        HAL_IRQ_EXIT_CRITICAL(irqState);
+        flags &= ~debounced;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+
+    while (flags != 0U)
+    {
+        physical_pin = 31U - (uint32_t)__builtin_clz(flags);
+        flags &= ~(1UL << physical_pin);
+
+        virtual_pin = s_pinReverseMap[port_index][physical_pin];
+
+        if ((virtual_pin != 0U) && (s_gpioCallbacks[virtual_pin - 1U] != NULL))
+        {
+            virtual_pin--;
+            event = s_pinTrigger[virtual_pin];
+
+            /* Với trigger cả hai cạnh, mức hiện tại cho biết cạnh vừa xảy ra */
+            if (HAL_GPIO_TRIGGER_EITHER_EDGE == event)
+            {
+                event = ((gpio->PDIR & (1UL << physical_pin)) != 0U) ? HAL_GPIO_TRIGGER_RISING_EDGE
+                                                                      : HAL_GPIO_TRIGGER_FALLING_EDGE;
+            }
+            else
+            {
+                /* Do nothing */
+            }
+
+            s_gpioCallbacks[virtual_pin](virtual_pin, event);
+        }
+        else
+        {
+            /* Do nothing, chân không được quản lý hoặc chưa đăng ký callback */
+        }
+    }
+}
+
+/**
+ * @brief Ghi trường IRQC của nhiều chân trên cùng một port.
+ * Bit ISF được giữ bằng 0 khi ghi để không xóa nhầm cờ của chân.
+ *
+ * @param port Thanh ghi PORT.
+ * @param pins Mặt nạ các chân vật lý.
+ * @param irqc_value Giá trị IRQC.
+ */
+static void HAL_GPIO_SetIrqc(PORT_Type *port, uint32_t pins, uint32_t irqc_value)
+{
+    uint32_t physical_pin = 0U;
+
+    while (pins != 0U)
+    {
+        physical_pin = 31U - (uint32_t)__builtin_clz(pins);
+        pins &= ~(1UL << physical_pin);
+
+        port->PCR[physical_pin] = (port->PCR[physical_pin] & ~(PORT_PCR_IRQC_MASK | PORT_PCR_ISF_MASK))
+                                | PORT_PCR_IRQC(irqc_value);
+    }
+}
+
+/**
+ * @brief Lấy mẫu và lọc nhiễu các chân đang thay đổi của một port.
+ * Một lần đọc PDIR cho cả port, bộ đếm dọc chấp nhận thay đổi sau 4 mẫu liên tiếp giống nhau.
+ * Chân đã ổn định và không còn chờ nhấn giữ được trả về chế độ chờ ngắt cạnh.
+ *
+ * @param port_index Chỉ số port (BOARD_PORT_INDEX_*).
+ */
+static void HAL_GPIO_DebouncePort(uint32_t port_index)
+{
+    hal_gpio_debounce_t * db = &s_debounce[port_index];
+    const GPIO_Type * gpio = s_gpioBase[port_index];
+    uint32_t sample = (gpio->PDIR ^ db->invert) & db->mask;
+    uint32_t changed = (db->stable ^ sample) & db->active;
+    uint32_t pins = 0U;
+    uint32_t physical_pin = 0U;
+    uint32_t virtual_pin = 0U;
+    uint32_t event = 0U;
+
+    /* Bộ đếm dọc: đếm xuống khi mẫu khác trạng thái đã lọc, nạp lại khi giống */
+    db->cnt0 = ~(db->cnt0 & changed);
+    db->cnt1 = db->cnt0 ^ (db->cnt1 & changed);
+    changed &= db->cnt0 & db->cnt1;
+    db->stable ^= changed;
+
+    /* Báo nhấn/nhả cho các chân vừa đổi trạng thái */
+    while (changed != 0U)
+    {
+        physical_pin = 31U - (uint32_t)__builtin_clz(changed);
+        changed &= ~(1UL << physical_pin);
+        virtual_pin = s_pinReverseMap[port_index][physical_pin] - 1U;
+
+        if ((db->stable & (1UL << physical_pin)) != 0U)
+        {
+            event = HAL_GPIO_EVENT_PRESS;
+            s_pinHoldTicks[virtual_pin] = 0U;
+
+            if (0U != s_longPressTicks)
+            {
+                db->holding |= (1UL << physical_pin);
+            }
+            else
+            {
+                /* Do nothing */
+            }
+        }
+        else
+        {
+            event = HAL_GPIO_EVENT_RELEASE;
+            db->holding &= ~(1UL << physical_pin);
+        }
+
+        if (s_gpioCallbacks[virtual_pin] != NULL)
+        {
+            s_gpioCallbacks[virtual_pin](virtual_pin, event);
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }
+
+    /* Đếm thời gian giữ của các chân đang nhấn, báo nhấn giữ một lần */
+    pins = db->holding;
+    while (pins != 0U)
     {
-        HAL_GPIO_ClearInterruptFlag(PIN_BUTTON1);
+        physical_pin = 31U - (uint32_t)__builtin_clz(pins);
+        pins &= ~(1UL << physical_pin);
+        virtual_pin = s_pinReverseMap[port_index][physical_pin] - 1U;
 
-        if (s_gpioCallbacks[PIN_BUTTON1] != NULL)
+        s_pinHoldTicks[virtual_pin]++;
+        if (s_pinHoldTicks[virtual_pin] >= s_longPressTicks)
+        {
+            db->holding &= ~(1UL << physical_pin);
+
+            if (s_gpioCallbacks[virtual_pin] != NULL)
+            {
+                s_gpioCallbacks[virtual_pin](virtual_pin, HAL_GPIO_EVENT_LONG_PRESS);
+            }
+            else
+            {
+                /* Do nothing */
+            }
+        }
+        else
         {
-            s_gpioCallbacks[PIN_BUTTON1](PIN_BUTTON1, HAL_GPIO_TRIGGER_FALLING_EDGE); /* Event: Falling edge */
+            /* Do nothing */
         }
     }
 
-    if (HAL_GPIO_IsInterruptFlagSet(PIN_BUTTON2))
+    /* Chân đã ổn định (bộ đếm đầy) và không chờ nhấn giữ: bật lại ngắt cạnh */
+    pins = db->active & db->cnt0 & db->cnt1 & ~db->holding;
+    if (pins != 0U)
+    {
+        HAL_GPIO_SetIrqc(s_portBase[port_index], pins, HAL_GPIO_IRQC_EITHER_EDGE);
+        db->active &= ~pins;
+
+        /* Cạnh xảy ra giữa lần lấy mẫu và lúc bật ngắt không tạo cờ, lấy mẫu lại để không bỏ sót */
+        sample = (gpio->PDIR ^ db->invert) & pins;
+        db->active |= (sample ^ db->stable) & pins;
+    }
+    else
     {
-        HAL_GPIO_ClearInterruptFlag(PIN_BUTTON2);
+        /* Do nothing */
+    }
+}
+
+void PORTA_IRQHandler(void)
+{
+    HAL_GPIO_DispatchPort(BOARD_PORT_INDEX_A, IP_PORTA, IP_PTA);
+}
+
+void PORTB_IRQHandler(void)
+{
+    HAL_GPIO_DispatchPort(BOARD_PORT_INDEX_B, IP_PORTB, IP_PTB);
+}
 
-        if (s_gpioCallbacks[PIN_BUTTON2] != NULL)
+void PORTC_IRQHandler(void)
+{
+    HAL_GPIO_DispatchPort(BOARD_PORT_INDEX_C, IP_PORTC, IP_PTC);
+}
+
+void PORTD_IRQHandler(void)
+{
+    HAL_GPIO_DispatchPort(BOARD_PORT_INDEX_D, IP_PORTD, IP_PTD);
+}
+
+void PORTE_IRQHandler(void)
+{
+    HAL_GPIO_DispatchPort(BOARD_PORT_INDEX_E, IP_PORTE, IP_PTE);
+}
+
+/**
+ * @brief Trình xử lý ngắt cho kênh 0 của LPIT (nhịp lấy mẫu của bộ lọc nhiễu).
+ * Ngắt này ưu tiên cao hơn ngắt PORT (HAL_IRQ_PRIO_TIMER so với HAL_IRQ_PRIO_GPIO) nên có
+ * thể chen ngang HAL_GPIO_DispatchPort; phía PORT cập nhật active trong critical section.
+ */
+void LPIT0_Ch0_IRQHandler(void)
+{
+    uint32_t port_index = 0U;
+    uint32_t active = 0U;
+
+    IP_LPIT0->MSR = LPIT_MSR_TIF0_MASK;
+
+    for (port_index = 0U; port_index < HAL_GPIO_PORT_COUNT; port_index++)
+    {
+        if (s_debounce[port_index].active != 0U)
+        {
+            HAL_GPIO_DebouncePort(port_index);
+            active |= s_debounce[port_index].active;
+        }
+        else
         {
-            s_gpioCallbacks[PIN_BUTTON2](PIN_BUTTON2, HAL_GPIO_TRIGGER_FALLING_EDGE); /* Event: Falling edge */
+            /* Do nothing */
         }
     }
+
+    /* Mọi chân đã ổn định, dừng nhịp cho đến ngắt cạnh kế tiếp */
+    if (0U == active)
+    {
+        IP_LPIT0->CLRTEN = LPIT_CLRTEN_CLR_T_EN_0_MASK;
+    }
+    else
+    {
+        /* Do nothing */
+    }
 }
@@ -5,6 +5,7 @@
  * Includes
  ******************************************************************************/
 #include "S32K144.h"
+#include "board_pins.h"
 #include "stdint.h"
 #include "stdbool.h"
 #include "stdlib.h"
@@ -64,6 +65,43 @@ typedef struct
     IRQn_Type irq_num;
 } pin_map_t;
 
+/**
+ * @brief Số pin tối đa của một nhóm và số port GPIO (PTA đến PTE)
+ */
+#define HAL_GPIO_GROUP_MAX_PINS     8U
+#define HAL_GPIO_PORT_COUNT         5U
+
+/**
+ * @brief Nhóm pin ảo được ghi cùng lúc, bit i của mask/values ứng với pin thứ i của nhóm.
+ * Thông tin port và mặt nạ vật lý của từng pin được tính sẵn khi khởi tạo nhóm.
+ */
+typedef struct
+{
+    GPIO_Type *gpio_base[HAL_GPIO_PORT_COUNT];      /* Các port có pin thuộc nhóm */
+    uint32_t pin_mask[HAL_GPIO_GROUP_MAX_PINS];     /* Mặt nạ vật lý của từng pin */
+    uint8_t port_index[HAL_GPIO_GROUP_MAX_PINS];    /* Vị trí port của từng pin trong gpio_base */
+    uint8_t pin_count;
+    uint8_t port_count;
+} hal_gpio_group_t;
+
+/**
+ * @brief Sự kiện của chân đã lọc nhiễu, báo qua cùng callback với sự kiện cạnh
+ * (HAL_GPIO_TRIGGER_RISING_EDGE/FALLING_EDGE) nên không trùng giá trị với chúng.
+ */
+#define HAL_GPIO_EVENT_PRESS        0x10U
+#define HAL_GPIO_EVENT_RELEASE      0x20U
+#define HAL_GPIO_EVENT_LONG_PRESS   0x40U
+
+/**
+ * @brief Kênh LPIT tạo nhịp lấy mẫu cho bộ lọc nhiễu (kênh còn trống của module sleep).
+ */
+#define HAL_GPIO_DEBOUNCE_CHANNEL   0U
+
+/**
+ * @brief Độ rộng bộ lọc số của PORT, tính theo chu kỳ LPO (tối đa 31).
+ */
+#define HAL_GPIO_DIGITAL_FILTER_WIDTH   31U
+
 /**
  * @brief Định nghĩa kiểu con trỏ hàm callback
  */
@@ -106,6 +144,27 @@ void HAL_GPIO_SetDirection(uint32_t virtual_pin, hal_gpio_direction_t dir);
  */
 void HAL_GPIO_WritePin(uint32_t virtual_pin, bool value);
 
+/**
+ * @brief Khởi tạo một nhóm pin ảo để ghi cùng lúc bằng HAL_GPIO_WriteGroup.
+ *
+ * @param group Nhóm cần khởi tạo.
+ * @param virtual_pins Danh sách pin ảo, pin thứ i ứng với bit i của mask/values.
+ * @param count Số pin (1 đến HAL_GPIO_GROUP_MAX_PINS).
+ * @return true nếu thành công, false nếu tham số hoặc pin không hợp lệ.
+ */
+bool HAL_GPIO_InitGroup(hal_gpio_group_t *group, const uint32_t *virtual_pins, uint32_t count);
+
+/**
+ * @brief Ghi nhiều chân Output của một nhóm cùng lúc.
+ * Các chân trên cùng một port được cập nhật bằng một lần ghi duy nhất nên không có
+ * trạng thái trung gian (ví dụ màu lẫn trên đèn RGB).
+ *
+ * @param group Nhóm đã khởi tạo.
+ * @param mask Các pin trong nhóm cần ghi (bit i ứng với pin thứ i).
+ * @param values Giá trị cần ghi cho các pin trong mask (bit = 1 cho HIGH).
+ */
+void HAL_GPIO_WriteGroup(const hal_gpio_group_t *group, uint32_t mask, uint32_t values);
+
 /**
  * @brief Đảo trạng thái của một chân Output.
  *
@@ -160,4 +219,29 @@ bool HAL_GPIO_IsInterruptFlagSet(uint32_t virtual_pin);
  */
 void HAL_GPIO_ClearInterruptFlag(uint32_t virtual_pin);
 
+/**
+ * @brief Khởi tạo nhịp lấy mẫu của bộ lọc nhiễu (kênh HAL_GPIO_DEBOUNCE_CHANNEL của LPIT).
+ * Nhịp chỉ chạy khi có chân đang thay đổi, lúc mọi chân đã ổn định thì LPIT dừng
+ * và các chân quay lại chờ ngắt cạnh.
+ * @note LPIT phải đã được cấp clock (ví dụ bởi module sleep) trước khi gọi hàm này.
+ *
+ * @param cycles_per_us Số chu kỳ clock của LPIT trong một micro-giây (ví dụ sleep_get_cycles_per_us()).
+ * @param tick_us Chu kỳ lấy mẫu (us). Một thay đổi được chấp nhận sau 4 mẫu liên tiếp giống nhau.
+ * @param long_press_ticks Số nhịp giữ nút để báo HAL_GPIO_EVENT_LONG_PRESS, 0 để tắt.
+ * @return true nếu thành công, false nếu tham số không hợp lệ (cycles_per_us bằng 0 hoặc chu kỳ tràn 32-bit).
+ */
+bool HAL_GPIO_DebounceInit(uint32_t cycles_per_us, uint32_t tick_us, uint32_t long_press_ticks);
+
+/**
+ * @brief Bật lọc nhiễu cho một chân input.
+ * Bộ lọc số của PORT (clock LPO) loại bỏ xung nhiễu ngắn, bộ tích phân theo nhịp LPIT
+ * loại bỏ dội phím. Ngắt cạnh của chân chỉ dùng để đánh thức bộ lọc: chân bị tắt ngắt
+ * cho đến khi ổn định, callback nhận HAL_GPIO_EVENT_PRESS/RELEASE/LONG_PRESS thay cho sự kiện cạnh.
+ *
+ * @param virtual_pin Pin ảo cần lọc nhiễu (đã cấu hình là input).
+ * @param active_low true nếu nút nhấn kéo chân xuống mức thấp khi nhấn.
+ * @return true nếu thành công, false nếu pin không hợp lệ hoặc chưa gọi HAL_GPIO_DebounceInit().
+ */
+bool HAL_GPIO_EnableDebounce(uint32_t virtual_pin, bool active_low);
+
 #endif /* HAL_GPIO_H_ */
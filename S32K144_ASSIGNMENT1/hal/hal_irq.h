@@ -0,0 +1,130 @@
+/**
+ * @file hal_irq.h
+ * @author benecosta2711
+ * @brief A library manage the NVIC interrupts of the project in one place.
+ * Current version of this library support:
+ * - Priority grouping of the NVIC set once at startup: every implemented bit is a preemption bit.
+ * - Per-IRQ priority from a central table, applied when a driver enables its interrupt.
+ * - Enable and disable helpers replacing the inline ISER/ICER writes in the drivers.
+ * - Nestable critical sections based on BASEPRI: only interrupts at HAL_IRQ_PRIO_CRITICAL or
+ *   lower priority are masked, higher priority ISRs keep running inside a section.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#ifndef HAL_IRQ_H_
+#define HAL_IRQ_H_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "S32K144.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/**
+ * @brief Number of priority bits implemented in the NVIC, 0 is the highest priority.
+ */
+#define HAL_IRQ_PRIO_BITS           __NVIC_PRIO_BITS
+#define HAL_IRQ_PRIO_LOWEST         ((1UL << HAL_IRQ_PRIO_BITS) - 1UL)
+
+/**
+ * @brief Priority grouping written to AIRCR[PRIGROUP] by HAL_IRQ_SetPriorityGrouping.
+ * The priority byte is split after bit PRIGROUP: bits above it are the preemption level, bits at
+ * or below it the subpriority. With the top HAL_IRQ_PRIO_BITS bits implemented, grouping
+ * (7 - HAL_IRQ_PRIO_BITS) leaves no subpriority, so every level of the table below preempts the
+ * levels under it and BASEPRI masks by the same levels. The reset value 0 gives the same split
+ * on this part, the write makes it independent of what a bootloader left in AIRCR.
+ */
+#define HAL_IRQ_PRIO_GROUPING       (7UL - HAL_IRQ_PRIO_BITS)
+
+/**
+ * @brief Priority levels of the project.
+ * The LPIT channels (debounce tick, sleep alarm) run above the GPIO ports so a debounce
+ * tick is not delayed by a burst of edge interrupts.
+ */
+#define HAL_IRQ_PRIO_TIMER          2U
+#define HAL_IRQ_PRIO_GPIO           3U
+
+/**
+ * @brief Critical sections mask this level and every lower priority (BASEPRI).
+ * The debounce state and the port outputs are shared by the LPIT and PORT handlers, so both
+ * levels are masked.
+ */
+#define HAL_IRQ_PRIO_CRITICAL       2U
+
+/**
+ * @brief Enters a critical section, the previous BASEPRI is saved in 'state'.
+ * BASEPRI_MAX only raises the masking level, so sections nest and a section entered from an
+ * ISR never unmasks a level already masked.
+ */
+#define HAL_IRQ_ENTER_CRITICAL(state)   __asm volatile ("mrs %0, basepri\n msr basepri_max, %1" \
+                                                        : "=&r" (state)                         \
+                                                        : "r" (HAL_IRQ_PRIO_CRITICAL << (8U - HAL_IRQ_PRIO_BITS)) \
+                                                        : "memory")
+
+/**
+ * @brief Leaves a critical section, restores the BASEPRI saved by HAL_IRQ_ENTER_CRITICAL.
+ */
+#define HAL_IRQ_EXIT_CRITICAL(state)    __asm volatile ("msr basepri, %0" : : "r" (state) : "memory")
+
+/**
+ * @brief Masks every interrupt (PRIMASK), the previous PRIMASK is saved in 'state'.
+ * Only for a WFI sequence: WFI wakes up on an interrupt pending behind PRIMASK but not on one
+ * masked by BASEPRI, so the check-then-sleep window must be closed with PRIMASK.
+ */
+#define HAL_IRQ_DISABLE_ALL(state)      __asm volatile ("mrs %0, primask\n cpsid i" : "=r" (state) : : "memory")
+
+/**
+ * @brief Restores the PRIMASK saved by HAL_IRQ_DISABLE_ALL.
+ */
+#define HAL_IRQ_RESTORE_ALL(state)      __asm volatile ("msr primask, %0" : : "r" (state) : "memory")
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+/**
+ * @brief Sets the priority grouping of the NVIC (AIRCR[PRIGROUP]).
+ * Call once at startup, before the first interrupt is enabled, with HAL_IRQ_PRIO_GROUPING.
+ *
+ * @param grouping Binary point of the priority byte, 0 to 7.
+ */
+void HAL_IRQ_SetPriorityGrouping(uint32_t grouping);
+
+/**
+ * @brief Sets the priority of an interrupt.
+ *
+ * @param irq Interrupt number (0 or above).
+ * @param priority Priority, 0 (highest) to HAL_IRQ_PRIO_LOWEST.
+ */
+void HAL_IRQ_SetPriority(IRQn_Type irq, uint32_t priority);
+
+/**
+ * @brief Gets the priority of an interrupt from the central table.
+ *
+ * @param irq Interrupt number.
+ * @return Priority of the table, HAL_IRQ_PRIO_LOWEST for an interrupt not listed.
+ */
+uint32_t HAL_IRQ_GetTablePriority(IRQn_Type irq);
+
+/**
+ * @brief Enables an interrupt in the NVIC with the priority of the central table.
+ *
+ * @param irq Interrupt number.
+ */
+void HAL_IRQ_Enable(IRQn_Type irq);
+
+/**
+ * @brief Disables an interrupt in the NVIC.
+ *
+ * @param irq Interrupt number.
+ */
+void HAL_IRQ_Disable(IRQn_Type irq);
+
+#endif /* HAL_IRQ_H_ */
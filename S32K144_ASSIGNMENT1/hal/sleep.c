@@ -0,0 +1,289 @@
+/**
+ * @file sleep.c
+ * @brief File triển khai module sleep.
+ * @details Báo thức được nạp với ngắt bị che (PRIMASK) rồi mới thực thi WFI. Nếu báo thức
+ * hết hạn trước WFI, ngắt đang chờ làm WFI trả về ngay nên không bị ngủ quên.
+ *
+ * @author Nguyen Vuong Trung Nam
+ * @date Oct 17, 2026
+ */
+
+#include "sleep.h"
+
+/* Tần số SIRC theo SIRCCFG[RANGE] */
+#define SLEEP_SIRC_HIGH_FREQ    8000000UL
+#define SLEEP_SIRC_LOW_FREQ     2000000UL
+
+/* Nguồn clock SIRCDIV2_CLK trong PCC[PCS] */
+#define SLEEP_PCS_SIRCDIV2      2U
+
+/* Số chu kỳ báo thức nhỏ nhất, tránh nạp một giá trị đã trôi qua */
+#define SLEEP_MIN_CYCLES        8U
+
+static uint32_t sleep_cycles_per_us = 0;
+static sleep_mode_t sleep_mode = SLEEP_MODE_WAIT;
+static volatile uint8_t sleep_wake_pending = 0;
+
+/**
+ * @brief Đọc số chu kỳ clock LPIT đã trôi qua từ hai kênh nối chuỗi.
+ * @return uint64_t Số chu kỳ.
+ */
+static uint64_t sleep_now_cycles(void)
+{
+    uint32_t high = 0;
+    uint32_t low = 0;
+    uint32_t check = IP_LPIT0->TMR[SLEEP_HIGH_CHANNEL].CVAL;
+
+    /* Đọc lại phần cao cho đến khi không đổi trong lúc đọc phần thấp */
+    do
+    {
+        high = check;
+        low = IP_LPIT0->TMR[SLEEP_LOW_CHANNEL].CVAL;
+        check = IP_LPIT0->TMR[SLEEP_HIGH_CHANNEL].CVAL;
+    } while (high != check);
+
+    /* Hai kênh đếm xuống từ 0xFFFFFFFF */
+    return ((uint64_t)(~high) << 32) | (uint64_t)(~low);
+}
+
+/**
+ * @brief Khởi tạo module sleep và bộ đếm thời gian.
+ * @copydoc sleep_init
+ */
+uint8_t sleep_init(sleep_mode_t mode)
+{
+    uint8_t retVal = 1U;
+    uint32_t div2 = 0;
+    uint32_t sirc_freq = 0;
+
+    sleep_mode = mode;
+
+    /* 1. Bật SIRCDIV2 (chia 1) nếu chưa được bật, SIRC tiếp tục chạy trong STOP */
+    if (0 == (IP_SCG->SIRCDIV & SCG_SIRCDIV_SIRCDIV2_MASK))
+    {
+        IP_SCG->SIRCDIV |= SCG_SIRCDIV_SIRCDIV2(1);
+    }
+    else
+    {
+        /* Do nothing */
+    }
+    IP_SCG->SIRCCSR |= SCG_SIRCCSR_SIRCSTEN_MASK;
+
+    div2 = (IP_SCG->SIRCDIV & SCG_SIRCDIV_SIRCDIV2_MASK) >> SCG_SIRCDIV_SIRCDIV2_SHIFT;
+    sirc_freq = (IP_SCG->SIRCCFG & SCG_SIRCCFG_RANGE_MASK) ? SLEEP_SIRC_HIGH_FREQ : SLEEP_SIRC_LOW_FREQ;
+    sleep_cycles_per_us = (sirc_freq >> (div2 - 1U)) / 1000000UL;
+
+    /* SIRCDIV2 dưới 1MHz cho 0 chu kỳ/us, không thể đổi sang micro-giây nên từ chối cấu hình */
+    if (0U == sleep_cycles_per_us)
+    {
+        retVal = 0U;
+    }
+    else
+    {
+        /* 2. Cấp clock SIRCDIV2_CLK cho LPIT, PCS chỉ được đổi khi clock gate tắt */
+        IP_PCC->PCCn[PCC_LPIT_INDEX] &= ~PCC_PCCn_CGC_MASK;
+        IP_PCC->PCCn[PCC_LPIT_INDEX] = PCC_PCCn_PCS(SLEEP_PCS_SIRCDIV2);
+        IP_PCC->PCCn[PCC_LPIT_INDEX] |= PCC_PCCn_CGC_MASK;
+
+        /* 3. Bật module LPIT, các kênh tiếp tục đếm khi debug và khi ngủ (doze) */
+        IP_LPIT0->MCR |= LPIT_MCR_M_CEN_MASK | LPIT_MCR_DBG_EN_MASK | LPIT_MCR_DOZE_EN_MASK;
+
+        /* 4. Bộ đếm 64-bit: kênh thấp đếm chu kỳ, kênh cao nối chuỗi, không ngắt */
+        IP_LPIT0->TMR[SLEEP_LOW_CHANNEL].TCTRL = LPIT_TMR_TCTRL_MODE(0);
+        IP_LPIT0->TMR[SLEEP_LOW_CHANNEL].TVAL = 0xFFFFFFFFUL;
+        IP_LPIT0->TMR[SLEEP_HIGH_CHANNEL].TCTRL = LPIT_TMR_TCTRL_MODE(0) | LPIT_TMR_TCTRL_CHAIN_MASK;
+        IP_LPIT0->TMR[SLEEP_HIGH_CHANNEL].TVAL = 0xFFFFFFFFUL;
+        IP_LPIT0->SETTEN = LPIT_SETTEN_SET_T_EN_2_MASK | LPIT_SETTEN_SET_T_EN_3_MASK;
+
+        /* 5. Kênh báo thức: chỉ chạy trong lúc ngủ, có ngắt */
+        IP_LPIT0->TMR[SLEEP_ALARM_CHANNEL].TCTRL = LPIT_TMR_TCTRL_MODE(0);
+        IP_LPIT0->MIER |= LPIT_MIER_TIE1_MASK;
+        HAL_IRQ_Enable(LPIT0_Ch1_IRQn);
+
+        /* 6. STOP: chọn normal STOP cho lần WFI có SLEEPDEEP */
+        if (SLEEP_MODE_STOP == sleep_mode)
+        {
+            IP_SMC->PMCTRL = (IP_SMC->PMCTRL & ~SMC_PMCTRL_STOPM_MASK) | SMC_PMCTRL_STOPM(0);
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }
+
+    return retVal;
+
+}
+
+/**
+ * @brief Đọc số micro-giây đã trôi qua.
+ * @copydoc sleep_now_us
+ */
+uint64_t sleep_now_us(void)
+{
+    uint64_t retVal = 0U;
+
+    if (0U != sleep_cycles_per_us)
+    {
+        retVal = sleep_now_cycles() / sleep_cycles_per_us;
+    }
+    else
+    {
+        /* Do nothing, chưa khởi tạo */
+    }
+
+    return retVal;
+
+}
+
+/**
+ * @brief Đọc số chu kỳ LPIT trong một micro-giây.
+ * @copydoc sleep_get_cycles_per_us
+ */
+uint32_t sleep_get_cycles_per_us(void)
+{
+    return sleep_cycles_per_us;
+
+}
+
+/**
+ * @brief Ngủ cho đến một mốc thời gian tuyệt đối hoặc đến khi có sleep_wakeup().
+ * @param[in] deadline_us Mốc thời gian (us) theo sleep_now_us().
+ * @param[in] wake_on_event 1 để trả về sớm khi có sleep_wakeup(), 0 để chỉ trả về khi đến hạn.
+ * @return uint8_t 1 nếu thức dậy do sleep_wakeup(), 0 nếu đến hạn.
+ */
+static uint8_t sleep_wait(uint64_t deadline_us, uint8_t wake_on_event)
+{
+    uint64_t deadline = deadline_us * sleep_cycles_per_us;
+    uint64_t now = 0;
+    uint64_t remaining = 0;
+    uint32_t primask = 0;
+    uint8_t woken = 0;
+    uint8_t done = 0;
+
+    /* Chưa khởi tạo hoặc cấu hình bị từ chối: bộ đếm không chạy nên không thể ngủ */
+    if (0U != sleep_cycles_per_us)
+    {
+        if (SLEEP_MODE_STOP == sleep_mode)
+        {
+            S32_SCB->SCR |= S32_SCB_SCR_SLEEPDEEP_MASK;
+        }
+        else
+        {
+            S32_SCB->SCR &= ~S32_SCB_SCR_SLEEPDEEP_MASK;
+        }
+
+        while (0U == done)
+        {
+            /* Che ngắt để báo thức không thể xảy ra giữa lúc nạp và lúc WFI */
+            HAL_IRQ_DISABLE_ALL(primask);
+
+            now = sleep_now_cycles();
+
+            /* Sự kiện được kiểm tra khi ngắt bị che nên không thể bị bỏ lỡ trước WFI */
+            if ((0U != wake_on_event) && (0U != sleep_wake_pending))
+            {
+                sleep_wake_pending = 0U;
+                woken = 1U;
+                done = 1U;
+            }
+            else if (now >= deadline)
+            {
+                done = 1U;
+            }
+            else
+            {
+                remaining = deadline - now;
+                if (remaining > 0xFFFFFFFFUL)
+                {
+                    /* Vượt quá 32-bit thì thức dậy giữa chừng rồi nạp tiếp */
+                    remaining = 0xFFFFFFFFUL;
+                }
+                else if (remaining < SLEEP_MIN_CYCLES)
+                {
+                    remaining = SLEEP_MIN_CYCLES;
+                }
+                else
+                {
+                    /* Do nothing */
+                }
+
+                IP_LPIT0->CLRTEN = LPIT_CLRTEN_CLR_T_EN_1_MASK;
+                IP_LPIT0->MSR = LPIT_MSR_TIF1_MASK;
+                IP_LPIT0->TMR[SLEEP_ALARM_CHANNEL].TVAL = (uint32_t)remaining - 1U;
+                IP_LPIT0->SETTEN = LPIT_SETTEN_SET_T_EN_1_MASK;
+
+                /* WFI trả về khi có ngắt đang chờ, kể cả khi PRIMASK đang che */
+                __asm volatile ("dsb");
+                __asm volatile ("wfi");
+                __asm volatile ("isb");
+            }
+
+            /* Mở ngắt để phục vụ ISR vừa đánh thức CPU (báo thức hoặc ngắt khác) */
+            HAL_IRQ_RESTORE_ALL(primask);
+        }
+
+        IP_LPIT0->CLRTEN = LPIT_CLRTEN_CLR_T_EN_1_MASK;
+        S32_SCB->SCR &= ~S32_SCB_SCR_SLEEPDEEP_MASK;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+
+    return woken;
+
+}
+
+/**
+ * @brief Ngủ cho đến một mốc thời gian tuyệt đối.
+ * @copydoc sleep_until
+ */
+void sleep_until(uint64_t deadline_us)
+{
+    (void)sleep_wait(deadline_us, 0U);
+
+}
+
+/**
+ * @brief Ngủ cho đến khi có sự kiện hoặc đến một mốc thời gian.
+ * @copydoc sleep_until_event
+ */
+uint8_t sleep_until_event(uint64_t deadline_us)
+{
+    return sleep_wait(deadline_us, 1U);
+
+}
+
+/**
+ * @brief Đánh thức sleep_until_event().
+ * @copydoc sleep_wakeup
+ */
+void sleep_wakeup(void)
+{
+    sleep_wake_pending = 1U;
+
+}
+
+/**
+ * @brief Ngủ trong một khoảng thời gian.
+ * @copydoc sleep_ms
+ */
+void sleep_ms(uint32_t ms)
+{
+    sleep_until(sleep_now_us() + ((uint64_t)ms * 1000U));
+
+}
+
+/**
+ * @brief Trình xử lý ngắt cho kênh 1 của LPIT (báo thức của sleep).
+ * @details Chỉ xóa cờ và dừng kênh, việc đánh thức CPU do chính ngắt này thực hiện.
+ * @param None
+ * @return None
+ */
+void LPIT0_Ch1_IRQHandler(void)
+{
+    IP_LPIT0->MSR = LPIT_MSR_TIF1_MASK;
+    IP_LPIT0->CLRTEN = LPIT_CLRTEN_CLR_T_EN_1_MASK;
+
+}
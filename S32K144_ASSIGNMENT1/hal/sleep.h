@@ -0,0 +1,96 @@
+/**
+ * @file sleep.h
+ * @brief Cung cấp hàm ngủ (sleep) dựa trên LPIT thay cho vòng lặp nop.
+ * @details Thời gian được đo bằng kênh 2 và 3 của LPIT nối chuỗi thành bộ đếm 64-bit,
+ * kênh 1 được nạp làm báo thức (compare). CPU thực thi WFI và chỉ thức dậy khi
+ * có ngắt, nên thời gian trễ đúng ở mọi tần số CPU và không tiêu tốn năng lượng
+ * cho vòng lặp chờ.
+ * @note LPIT được cấp clock từ SIRCDIV2_CLK (SIRC 8MHz), không phụ thuộc cấu hình
+ * SPLL/RUN mode. Kênh 0 của LPIT vẫn để trống cho ứng dụng.
+ *
+ * @author Nguyen Vuong Trung Nam
+ * @date Oct 17, 2026
+ */
+
+#ifndef SLEEP_H_
+#define SLEEP_H_
+
+#include "stdint.h"
+#include "S32K144.h"
+#include "S32K144_features.h"
+#include "hal_irq.h"
+
+/**
+ * @brief Kênh LPIT dùng làm báo thức và làm bộ đếm thời gian 64-bit.
+ */
+#define SLEEP_ALARM_CHANNEL     1U
+#define SLEEP_LOW_CHANNEL       2U
+#define SLEEP_HIGH_CHANNEL      3U
+
+/**
+ * @brief Chế độ năng lượng khi ngủ.
+ */
+typedef enum
+{
+    SLEEP_MODE_WAIT = 0,    /* WFI với SLEEPDEEP = 0: chỉ dừng clock của lõi, thức dậy nhanh nhất */
+    SLEEP_MODE_STOP = 1     /* WFI với SLEEPDEEP = 1: normal STOP, SIRC và LPIT vẫn chạy */
+} sleep_mode_t;
+
+/**
+ * @brief Khởi tạo module sleep và bộ đếm thời gian.
+ * @note Phải gọi trước các module khác dùng LPIT, vì hàm này chọn nguồn clock cho LPIT.
+ * Các module đó không được reset LPIT bằng phần mềm (MCR[SW_RST]).
+ * @param[in] mode Chế độ năng lượng dùng cho sleep_ms() và sleep_until().
+ * @return uint8_t 1 nếu thành công, 0 nếu SIRCDIV2_CLK nhỏ hơn 1MHz (không đổi được sang micro-giây);
+ * khi đó LPIT không được cấu hình, sleep_now_us() trả về 0 và sleep_until() trả về ngay.
+ */
+uint8_t sleep_init(sleep_mode_t mode);
+
+/**
+ * @brief Đọc số micro-giây đã trôi qua kể từ sleep_init().
+ * @param None
+ * @return uint64_t Số micro-giây.
+ */
+uint64_t sleep_now_us(void);
+
+/**
+ * @brief Đọc số chu kỳ clock của LPIT trong một micro-giây.
+ * @note Dùng cho module khác cấu hình kênh LPIT còn trống (kênh 0) với cùng nguồn clock.
+ * @param None
+ * @return uint32_t Số chu kỳ, 0 nếu chưa gọi sleep_init().
+ */
+uint32_t sleep_get_cycles_per_us(void);
+
+/**
+ * @brief Ngủ cho đến một mốc thời gian tuyệt đối.
+ * @note Dùng cho tác vụ định kỳ: cộng chu kỳ vào mốc trước đó để không bị trôi.
+ * Các ngắt khác vẫn được phục vụ trong lúc ngủ, hàm chỉ trả về khi đến hạn.
+ * @param[in] deadline_us Mốc thời gian (us) theo sleep_now_us().
+ * @return None
+ */
+void sleep_until(uint64_t deadline_us);
+
+/**
+ * @brief Ngủ cho đến khi có sự kiện (sleep_wakeup()) hoặc đến một mốc thời gian tuyệt đối.
+ * @note Dùng cho vòng lặp hướng sự kiện: sự kiện xảy ra trước khi gọi hàm vẫn được giữ lại
+ * nên hàm trả về ngay, không bị ngủ quên.
+ * @param[in] deadline_us Mốc thời gian (us) theo sleep_now_us().
+ * @return uint8_t 1 nếu thức dậy do sự kiện, 0 nếu đến hạn.
+ */
+uint8_t sleep_until_event(uint64_t deadline_us);
+
+/**
+ * @brief Báo có sự kiện cho sleep_until_event(), gọi được từ ISR hoặc callback.
+ * @param None
+ * @return None
+ */
+void sleep_wakeup(void);
+
+/**
+ * @brief Ngủ trong một khoảng thời gian.
+ * @param[in] ms Thời gian ngủ tính bằng mili-giây.
+ * @return None
+ */
+void sleep_ms(uint32_t ms);
+
+#endif /* SLEEP_H_ */
@@ -11,6 +11,10 @@
 #include <stdio.h>
 
 #include "Driver_GPIO.h"
+#include "hal_gpio.h"
+#include "hal_irq.h"
+#include "board_pins.h"
+#include "sleep.h"
 
 extern ARM_DRIVER_GPIO Driver_GPIO0;
 
@@ -28,13 +32,12 @@ extern ARM_DRIVER_GPIO Driver_GPIO0;
     #define __NO_RETURN
 #endif
 
-#define CPU_CLOCK_FREQ      8000000UL
-#define CYCLES_PER_MS       (CPU_CLOCK_FREQ / 1000UL)
+/* Không có tác vụ định kỳ: vòng lặp chỉ thức dậy khi có sự kiện nút nhấn, hoặc sau thời gian chờ này */
+#define APP_IDLE_TIMEOUT_MS     1000U
 
-#define PIN_BUTTON1	 			0
-#define PIN_BUTTON2	 			1
-#define PIN_LED_RED				2
-#define PIN_LED_GREEN			3
+/* Lọc nhiễu nút nhấn: lấy mẫu mỗi 5ms, nhấn được chấp nhận sau 4 mẫu (20ms), không dùng nhấn giữ */
+#define BUTTON_DEBOUNCE_TICK_US     5000U
+#define BUTTON_LONG_PRESS_TICKS     0U
 
 #define BUTTON_PRESSED			1
 #define BUTTON_RELEASE			0
@@ -42,8 +45,8 @@ extern ARM_DRIVER_GPIO Driver_GPIO0;
 #define LED_OFF					0
 #define LED_ON					1
 
-void System_DelayMs(uint32_t delay_in_ms);
 void App_GPIO_CallBack(uint32_t pin, uint32_t event);
+static void App_ErrorHandler(void);
 
 volatile uint8_t g_is_button1_press_flag = BUTTON_RELEASE;
 volatile uint8_t g_is_button2_press_flag = BUTTON_RELEASE;
@@ -53,6 +56,20 @@ volatile uint8_t g_is_button2_press_flag = BUTTON_RELEASE;
 int main(void) {
 	ARM_DRIVER_GPIO* gpio_drv = &Driver_GPIO0;
 
+	/* Chia nhóm ưu tiên trước khi bật ngắt đầu tiên: mọi bit ưu tiên đều là bit preempt */
+	HAL_IRQ_SetPriorityGrouping(HAL_IRQ_PRIO_GROUPING);
+
+	/* LPIT chưa có clock hợp lệ cho sleep và lọc nhiễu nút nhấn */
+	if (0U == sleep_init(SLEEP_MODE_WAIT))
+	{
+		App_ErrorHandler();
+	}
+
+	if (!HAL_GPIO_DebounceInit(sleep_get_cycles_per_us(), BUTTON_DEBOUNCE_TICK_US, BUTTON_LONG_PRESS_TICKS))
+	{
+		App_ErrorHandler();
+	}
+
 	gpio_drv->Setup(PIN_LED_RED, NULL);
 	gpio_drv->SetDirection(PIN_LED_RED, ARM_GPIO_OUTPUT);
 	gpio_drv->SetOutput(PIN_LED_RED, 0);
@@ -64,12 +81,18 @@ int main(void) {
 	gpio_drv->Setup(PIN_BUTTON1, App_GPIO_CallBack);
 	gpio_drv->SetDirection(PIN_BUTTON1, ARM_GPIO_INPUT);
 	gpio_drv->SetPullResistor(PIN_BUTTON1, ARM_GPIO_PULL_NONE);
-	gpio_drv->SetEventTrigger(PIN_BUTTON1, ARM_GPIO_TRIGGER_FALLING_EDGE);
+	if (!HAL_GPIO_EnableDebounce(PIN_BUTTON1, true))
+	{
+		App_ErrorHandler();
+	}
 
 	gpio_drv->Setup(PIN_BUTTON2, App_GPIO_CallBack);
 	gpio_drv->SetDirection(PIN_BUTTON2, ARM_GPIO_INPUT);
 	gpio_drv->SetPullResistor(PIN_BUTTON2, ARM_GPIO_PULL_NONE);
-	gpio_drv->SetEventTrigger(PIN_BUTTON2, ARM_GPIO_TRIGGER_FALLING_EDGE);
+	if (!HAL_GPIO_EnableDebounce(PIN_BUTTON2, true))
+	{
+		App_ErrorHandler();
+	}
 
 	uint8_t led_green_status = LED_OFF;
 	uint8_t led_red_status = LED_OFF;
@@ -81,7 +104,7 @@ int main(void) {
 			g_is_button1_press_flag = BUTTON_RELEASE;
 			led_red_status = (led_red_status == LED_OFF) ? LED_ON : LED_OFF;
 
-			gpio_drv->SetOutput(PIN_LED_RED, led_red_status);
+			BOARD_LED_RED_Write(led_red_status);
 
 		}
 
@@ -90,11 +113,12 @@ int main(void) {
 			g_is_button2_press_flag = BUTTON_RELEASE;
 			led_green_status = (led_green_status == LED_OFF) ? LED_ON : LED_OFF;
 
-			gpio_drv->SetOutput(PIN_LED_GREEN, led_green_status);
+			BOARD_LED_GREEN_Write(led_green_status);
 
 		}
 
-		System_DelayMs(100);
+		/* Ngủ cho đến khi callback báo có nút nhấn, thời gian chờ chỉ là mốc an toàn */
+		(void)sleep_until_event(sleep_now_us() + ((uint64_t)APP_IDLE_TIMEOUT_MS * 1000U));
 
 	}
 
@@ -104,28 +128,32 @@ int main(void) {
 
 }
 
-void System_DelayMs(uint32_t delay_in_ms)
-{
-    volatile uint32_t loop_count;
-    while(delay_in_ms--)
-    {
-        for(loop_count = 0; loop_count < CYCLES_PER_MS; loop_count++)
-        {
-            __asm("nop");
-        }
-    }
-}
-
 void App_GPIO_CallBack(uint32_t pin, uint32_t event)
 {
-	if (PIN_BUTTON1 == pin)
+	if (HAL_GPIO_EVENT_PRESS != event)
+	{
+		/* Do nothing, chỉ sự kiện nhấn đã lọc nhiễu đổi trạng thái LED */
+	}
+	else if (PIN_BUTTON1 == pin)
 	{
 		g_is_button1_press_flag = BUTTON_PRESSED;
+		sleep_wakeup();
 
 	}
 	else if (PIN_BUTTON2 == pin)
 	{
 		g_is_button2_press_flag = BUTTON_PRESSED;
+		sleep_wakeup();
+
+	}
+}
 
+/**
+ * @brief Dừng chương trình khi khởi tạo thất bại.
+ */
+static void App_ErrorHandler(void)
+{
+	for(;;)
+	{
 	}
 }
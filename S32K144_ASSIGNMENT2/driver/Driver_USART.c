@@ -3,6 +3,41 @@
 
 #define ARM_USART_DRV_VERSION    ARM_DRIVER_VERSION_MAJOR_MINOR(1, 0)  /* driver version */
 
+/*
+ * Transfer mode of each driver instance, may be overridden from the build.
+ * Send/Receive move the whole buffer with eDMA (1) or byte by byte in the LPUART ISR (0),
+ * HAL_DMA_Init must be called by the application before a DMA instance is used.
+ * Driver_USART1 is the console of app_uart: its receive shares RDRF with the line
+ * handler, which a DMA receive would switch off, so it stays in interrupt mode.
+ */
+#ifndef ARM_USART0_USE_DMA
+#define ARM_USART0_USE_DMA          1U
+#endif
+
+#ifndef ARM_USART1_USE_DMA
+#define ARM_USART1_USE_DMA          0U
+#endif
+
+#ifndef ARM_USART2_USE_DMA
+#define ARM_USART2_USE_DMA          1U
+#endif
+
+/*
+ * Driver instance table: X(driver number, HAL instance, use DMA).
+ * Driver_USARTn is generated for every entry.
+ */
+#define ARM_USART_DRIVER_LIST(X)                \
+	X(0, HAL_LPUART0, ARM_USART0_USE_DMA)       \
+	X(1, HAL_LPUART1, ARM_USART1_USE_DMA)       \
+	X(2, HAL_LPUART2, ARM_USART2_USE_DMA)
+
+/* Resources of one driver instance */
+typedef struct
+{
+	uint32_t instance;             /* HAL UART instance */
+	uint8_t  useDma;               /* Send/Receive through eDMA */
+} ARM_USART_RESOURCES;
+
 /* Driver Version */
 static const ARM_DRIVER_VERSION DriverVersion = { 
     ARM_USART_API_VERSION,
@@ -21,7 +56,7 @@ static const ARM_USART_CAPABILITIES DriverCapabilities = {
     0, /* RTS Flow Control available */
     0, /* CTS Flow Control available */
     0, /* Transmit completed event: \ref ARM_USART_EVENT_TX_COMPLETE */
-    0, /* Signal receive character timeout event: \ref ARM_USART_EVENT_RX_TIMEOUT */
+    1, /* Signal receive character timeout event: \ref ARM_USART_EVENT_RX_TIMEOUT */
     0, /* RTS Line: 0=not available, 1=available */
     0, /* CTS Line: 0=not available, 1=available */
     0, /* DTR Line: 0=not available, 1=available */
@@ -49,18 +84,18 @@ static ARM_USART_CAPABILITIES ARM_USART_GetCapabilities(void)
   return DriverCapabilities;
 }
 
-static int32_t ARM_USART_Initialize(ARM_USART_SignalEvent_t cb_event)
+static int32_t ARM_USART_Initialize(const ARM_USART_RESOURCES *res, ARM_USART_SignalEvent_t cb_event)
 {
 	int32_t retVal = ARM_DRIVER_OK;
 
 	/* Enable clock for related peripheral and config alt for pin */
-	if(HAL_UART_Init(HAL_LPUART1) == 1)
+	if(HAL_UART_Init(res->instance) == 1)
 	{
 		/* Config base on driver capacibilities */
 		if(NULL != cb_event)
 		{
 			/* Enable all possible interrupt to create event from hardware to the application */
-			HAL_UART_RegisterCallback(HAL_LPUART1, cb_event);
+			HAL_UART_RegisterCallback(res->instance, cb_event);
 		}
 		else
 		{
@@ -76,18 +111,20 @@ static int32_t ARM_USART_Initialize(ARM_USART_SignalEvent_t cb_event)
 	return retVal;
 }
 
-static int32_t ARM_USART_Uninitialize(void)
+static int32_t ARM_USART_Uninitialize(const ARM_USART_RESOURCES *res)
 {
 	int32_t retVal = ARM_DRIVER_OK;
 
-	HAL_UART_Deinit(HAL_LPUART1);
+	HAL_UART_Deinit(res->instance);
 
 	return retVal;
 
 }
 
-static int32_t ARM_USART_PowerControl(ARM_POWER_STATE state)
+static int32_t ARM_USART_PowerControl(const ARM_USART_RESOURCES *res, ARM_POWER_STATE state)
 {
+    (void)res;
+
     switch (state)
     {
     case ARM_POWER_OFF:
@@ -102,7 +139,7 @@ static int32_t ARM_USART_PowerControl(ARM_POWER_STATE state)
     return ARM_DRIVER_OK;
 }
 
-static int32_t ARM_USART_Send(const void *data, uint32_t num)
+static int32_t ARM_USART_Send(const ARM_USART_RESOURCES *res, const void *data, uint32_t num)
 {
 	int32_t retVal = ARM_DRIVER_OK;
 
@@ -112,19 +149,36 @@ static int32_t ARM_USART_Send(const void *data, uint32_t num)
 	}
 	else
 	{
-		uint8_t* txData = (uint8_t*)data;
-
-		g_txBuffer = txData;
-		g_txBufferLength = num;
-
-		HAL_UART_EnableInterrupts(HAL_LPUART1, HAL_UART_INT_TX_DATA_REG_EMPTY);
+		if(HAL_UART_IsTxBusy(res->instance) != 0U)
+		{
+			retVal = ARM_DRIVER_ERROR_BUSY;
+		}
+		else if(res->useDma != 0U)
+		{
+			if(HAL_UART_SendDma(res->instance, (const uint8_t*)data, num) == 0U)
+			{
+				retVal = ARM_DRIVER_ERROR_PARAMETER;
+			}
+			else
+			{
+				/* Do nothing */
+			}
+		}
+		else if(HAL_UART_Send(res->instance, (const uint8_t*)data, num) == 0U)
+		{
+			retVal = ARM_DRIVER_ERROR;
+		}
+		else
+		{
+			/* Do nothing */
+		}
 	}
 
 	return retVal;
 
 }
 
-static int32_t ARM_USART_Receive(void *data, uint32_t num)
+static int32_t ARM_USART_Receive(const ARM_USART_RESOURCES *res, void *data, uint32_t num)
 {
 	int32_t retVal = ARM_DRIVER_OK;
 
@@ -134,34 +188,55 @@ static int32_t ARM_USART_Receive(void *data, uint32_t num)
 	}
 	else
 	{
-		uint8_t* rxData = (uint8_t*)data;
-
-		g_rxBuffer = rxData;
-		g_rxBufferLength = num;
-
-		HAL_UART_EnableInterrupts(HAL_LPUART1, HAL_UART_INT_RX_DATA_REG_FULL);
+		if(HAL_UART_IsRxBusy(res->instance) != 0U)
+		{
+			retVal = ARM_DRIVER_ERROR_BUSY;
+		}
+		else if(res->useDma != 0U)
+		{
+			if(HAL_UART_ReceiveDma(res->instance, (uint8_t*)data, num) == 0U)
+			{
+				retVal = ARM_DRIVER_ERROR_PARAMETER;
+			}
+			else
+			{
+				/* Do nothing */
+			}
+		}
+		else if(HAL_UART_Receive(res->instance, (uint8_t*)data, num) == 0U)
+		{
+			retVal = ARM_DRIVER_ERROR;
+		}
+		else
+		{
+			/* Do nothing */
+		}
 	}
 
 
 	return retVal;
 }
 
-static int32_t ARM_USART_Transfer(const void *data_out, void *data_in, uint32_t num)
+static int32_t ARM_USART_Transfer(const ARM_USART_RESOURCES *res, const void *data_out, void *data_in, uint32_t num)
 {
+	(void)res;
+
 	return 0;
 }
 
-static uint32_t ARM_USART_GetTxCount(void)
+static uint32_t ARM_USART_GetTxCount(const ARM_USART_RESOURCES *res)
 {
-	return 0;
+	/* Live progress, read back from the DMA channel in DMA mode */
+	return HAL_UART_GetTxCount(res->instance);
 }
 
-static uint32_t ARM_USART_GetRxCount(void)
+static uint32_t ARM_USART_GetRxCount(const ARM_USART_RESOURCES *res)
 {
-	return 0;
+	/* Live progress, read back from the DMA channel in DMA mode */
+	return HAL_UART_GetRxCount(res->instance);
 }
 
-static int32_t ARM_USART_Control(uint32_t control, uint32_t arg)
+static int32_t ARM_USART_Control(const ARM_USART_RESOURCES *res, uint32_t control, uint32_t arg)
 {
 	hal_uart_config_t uartConfig;
 	uint32_t retVal = ARM_DRIVER_OK;
@@ -224,9 +299,10 @@ static int32_t ARM_USART_Control(uint32_t control, uint32_t arg)
 			break;
 		}
 
-		if(HAL_UART_Configure(HAL_LPUART1, &uartConfig) == 0)
+		if(HAL_UART_Configure(res->instance, &uartConfig) == 0)
 		{
-			retVal = ARM_DRIVER_ERROR;
+			/* Baud rate not reachable within tolerance from the LPUART clock */
+			retVal = ARM_USART_ERROR_BAUDRATE;
 		}
 		else
 		{
@@ -236,8 +312,8 @@ static int32_t ARM_USART_Control(uint32_t control, uint32_t arg)
 
 	if(retVal == ARM_DRIVER_OK)
 	{
-		HAL_UART_EnableTransmitter(HAL_LPUART1, 1);
-		HAL_UART_EnableReceiver(HAL_LPUART1, 1);
+		HAL_UART_EnableTransmitter(res->instance, 1);
+		HAL_UART_EnableReceiver(res->instance, 1);
 	}
 	else
 	{
@@ -248,7 +324,7 @@ static int32_t ARM_USART_Control(uint32_t control, uint32_t arg)
 	return retVal;
 }
 
-static ARM_USART_STATUS ARM_USART_GetStatus(void)
+static ARM_USART_STATUS ARM_USART_GetStatus(const ARM_USART_RESOURCES *res)
 {
 	ARM_USART_STATUS retVal = {
 			.tx_busy = 0,
@@ -260,11 +336,10 @@ static ARM_USART_STATUS ARM_USART_GetStatus(void)
 			.rx_parity_error = 0,
 			.reserved = 0
 	};
-	uint32_t stat_reg = HAL_UART_GetStatusFlags(HAL_LPUART1);
+	uint32_t stat_reg = HAL_UART_GetStatusFlags(res->instance);
 
-
-	retVal.tx_busy = (NULL == g_txBuffer) ? 0 : 1;
-	retVal.rx_busy = (NULL == g_rxBuffer) ? 0 : 1;
+	retVal.tx_busy = HAL_UART_IsTxBusy(res->instance);
+	retVal.rx_busy = HAL_UART_IsRxBusy(res->instance);
 	retVal.rx_framing_error = (stat_reg & LPUART_STAT_FE_MASK) ? 1 : 0;
 	retVal.rx_overflow = (stat_reg & LPUART_STAT_OR_MASK) ? 1 : 0;
 	retVal.rx_parity_error = (stat_reg & LPUART_STAT_PF_MASK) ? 1 : 0;
@@ -272,13 +347,17 @@ static ARM_USART_STATUS ARM_USART_GetStatus(void)
 	return retVal;
 }
 
-static int32_t ARM_USART_SetModemControl(ARM_USART_MODEM_CONTROL control)
+static int32_t ARM_USART_SetModemControl(const ARM_USART_RESOURCES *res, ARM_USART_MODEM_CONTROL control)
 {
+	(void)res;
+
 	return 0;
 }
 
-static ARM_USART_MODEM_STATUS ARM_USART_GetModemStatus(void)
+static ARM_USART_MODEM_STATUS ARM_USART_GetModemStatus(const ARM_USART_RESOURCES *res)
 {
+	(void)res;
+
 	/* Dummy data */
 	ARM_USART_MODEM_STATUS retVal = {
 			.cts = 0,
@@ -299,21 +378,49 @@ static void ARM_USART_SignalEvent(uint32_t event)
 
 // End USART Interface
 
-extern \
-ARM_DRIVER_USART Driver_USART0;
-ARM_DRIVER_USART Driver_USART0 = {
-    ARM_USART_GetVersion,
-    ARM_USART_GetCapabilities,
-    ARM_USART_Initialize,
-    ARM_USART_Uninitialize,
-    ARM_USART_PowerControl,
-    ARM_USART_Send,
-    ARM_USART_Receive,
-    ARM_USART_Transfer,
-    ARM_USART_GetTxCount,
-    ARM_USART_GetRxCount,
-    ARM_USART_Control,
-    ARM_USART_GetStatus,
-    ARM_USART_SetModemControl,
-    ARM_USART_GetModemStatus
+/* Generate the resources, the wrappers and the access struct of Driver_USARTn */
+#define ARM_USART_DRIVER(n, hal_instance, use_dma)                                                          \
+static const ARM_USART_RESOURCES USART##n##_Resources = { hal_instance, use_dma };                          \
+static int32_t USART##n##_Initialize(ARM_USART_SignalEvent_t cb_event)                                      \
+{ return ARM_USART_Initialize(&USART##n##_Resources, cb_event); }                                           \
+static int32_t USART##n##_Uninitialize(void)                                                                \
+{ return ARM_USART_Uninitialize(&USART##n##_Resources); }                                                   \
+static int32_t USART##n##_PowerControl(ARM_POWER_STATE state)                                               \
+{ return ARM_USART_PowerControl(&USART##n##_Resources, state); }                                            \
+static int32_t USART##n##_Send(const void *data, uint32_t num)                                              \
+{ return ARM_USART_Send(&USART##n##_Resources, data, num); }                                                \
+static int32_t USART##n##_Receive(void *data, uint32_t num)                                                 \
+{ return ARM_USART_Receive(&USART##n##_Resources, data, num); }                                             \
+static int32_t USART##n##_Transfer(const void *data_out, void *data_in, uint32_t num)                       \
+{ return ARM_USART_Transfer(&USART##n##_Resources, data_out, data_in, num); }                               \
+static uint32_t USART##n##_GetTxCount(void)                                                                 \
+{ return ARM_USART_GetTxCount(&USART##n##_Resources); }                                                     \
+static uint32_t USART##n##_GetRxCount(void)                                                                 \
+{ return ARM_USART_GetRxCount(&USART##n##_Resources); }                                                     \
+static int32_t USART##n##_Control(uint32_t control, uint32_t arg)                                           \
+{ return ARM_USART_Control(&USART##n##_Resources, control, arg); }                                          \
+static ARM_USART_STATUS USART##n##_GetStatus(void)                                                          \
+{ return ARM_USART_GetStatus(&USART##n##_Resources); }                                                      \
+static int32_t USART##n##_SetModemControl(ARM_USART_MODEM_CONTROL control)                                  \
+{ return ARM_USART_SetModemControl(&USART##n##_Resources, control); }                                       \
+static ARM_USART_MODEM_STATUS USART##n##_GetModemStatus(void)                                               \
+{ return ARM_USART_GetModemStatus(&USART##n##_Resources); }                                                 \
+extern ARM_DRIVER_USART Driver_USART##n;                                                                    \
+ARM_DRIVER_USART Driver_USART##n = {                                                                        \
+    ARM_USART_GetVersion,                                                                                   \
+    ARM_USART_GetCapabilities,                                                                              \
+    USART##n##_Initialize,                                                                                  \
+    USART##n##_Uninitialize,                                                                                \
+    USART##n##_PowerControl,                                                                                \
+    USART##n##_Send,                                                                                        \
+    USART##n##_Receive,                                                                                     \
+    USART##n##_Transfer,                                                                                    \
+    USART##n##_GetTxCount,                                                                                  \
+    USART##n##_GetRxCount,                                                                                  \
+    USART##n##_Control,                                                                                     \
+    USART##n##_GetStatus,                                                                                   \
+    USART##n##_SetModemControl,                                                                             \
+    USART##n##_GetModemStatus                                                                               \
 };
+
+ARM_USART_DRIVER_LIST(ARM_USART_DRIVER)
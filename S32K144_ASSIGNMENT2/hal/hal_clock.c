@@ -0,0 +1,113 @@
+/**
+ * @file hal_clock.c
+ * @author benecosta2711
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include "hal_clock.h"
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+static uint32_t HAL_CLOCK_ApplyDiv2(uint32_t sourceFreq, uint32_t divField);
+static uint32_t HAL_CLOCK_GetSpllFreq(void);
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+/**
+ * @brief Applies a DIV2 field (0: disabled, n: divide by 2^(n-1)) to a source frequency.
+ */
+static uint32_t HAL_CLOCK_ApplyDiv2(uint32_t sourceFreq, uint32_t divField)
+{
+    uint32_t freq = 0U;
+
+    if (divField != 0U)
+    {
+        freq = sourceFreq >> (divField - 1U);
+    }
+    else
+    {
+        /* Do nothing */
+    }
+
+    return freq;
+}
+
+/**
+ * @brief Gets the SPLL VCO output divided by 2: (SOSC / (PREDIV + 1)) * (MULT + 16) / 2.
+ */
+static uint32_t HAL_CLOCK_GetSpllFreq(void)
+{
+    uint32_t freq = 0U;
+    uint32_t prediv = 0U;
+    uint32_t mult = 0U;
+
+    if ((IP_SCG->SPLLCSR & SCG_SPLLCSR_SPLLVLD_MASK) != 0U)
+    {
+        prediv = ((IP_SCG->SPLLCFG & SCG_SPLLCFG_PREDIV_MASK) >> SCG_SPLLCFG_PREDIV_SHIFT) + 1U;
+        mult = ((IP_SCG->SPLLCFG & SCG_SPLLCFG_MULT_MASK) >> SCG_SPLLCFG_MULT_SHIFT) + 16U;
+        freq = ((HAL_CLOCK_SOSC_FREQ / prediv) * mult) / 2U;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+
+    return freq;
+}
+
+uint32_t HAL_CLOCK_GetDiv2Freq(hal_clock_pcs_t pcs)
+{
+    uint32_t freq = 0U;
+
+    switch (pcs)
+    {
+    case HAL_CLOCK_PCS_SOSCDIV2:
+        if ((IP_SCG->SOSCCSR & SCG_SOSCCSR_SOSCVLD_MASK) != 0U)
+        {
+            freq = HAL_CLOCK_ApplyDiv2(HAL_CLOCK_SOSC_FREQ,
+                    (IP_SCG->SOSCDIV & SCG_SOSCDIV_SOSCDIV2_MASK) >> SCG_SOSCDIV_SOSCDIV2_SHIFT);
+        }
+        break;
+
+    case HAL_CLOCK_PCS_SIRCDIV2:
+        if ((IP_SCG->SIRCCSR & SCG_SIRCCSR_SIRCVLD_MASK) != 0U)
+        {
+            freq = ((IP_SCG->SIRCCFG & SCG_SIRCCFG_RANGE_MASK) != 0U) ? HAL_CLOCK_SIRC_HIGH_FREQ : HAL_CLOCK_SIRC_LOW_FREQ;
+            freq = HAL_CLOCK_ApplyDiv2(freq,
+                    (IP_SCG->SIRCDIV & SCG_SIRCDIV_SIRCDIV2_MASK) >> SCG_SIRCDIV_SIRCDIV2_SHIFT);
+        }
+        break;
+
+    case HAL_CLOCK_PCS_FIRCDIV2:
+        if ((IP_SCG->FIRCCSR & SCG_FIRCCSR_FIRCVLD_MASK) != 0U)
+        {
+            freq = HAL_CLOCK_ApplyDiv2(HAL_CLOCK_FIRC_FREQ,
+                    (IP_SCG->FIRCDIV & SCG_FIRCDIV_FIRCDIV2_MASK) >> SCG_FIRCDIV_FIRCDIV2_SHIFT);
+        }
+        break;
+
+    case HAL_CLOCK_PCS_SPLLDIV2:
+        freq = HAL_CLOCK_ApplyDiv2(HAL_CLOCK_GetSpllFreq(),
+                (IP_SCG->SPLLDIV & SCG_SPLLDIV_SPLLDIV2_MASK) >> SCG_SPLLDIV_SPLLDIV2_SHIFT);
+        break;
+
+    default:
+        break;
+    }
+
+    return freq;
+}
+
+uint32_t HAL_CLOCK_GetPeripheralFreq(uint32_t pccIndex)
+{
+    uint32_t pcc_val = IP_PCC->PCCn[pccIndex];
+
+    return HAL_CLOCK_GetDiv2Freq((hal_clock_pcs_t)((pcc_val & PCC_PCCn_PCS_MASK) >> PCC_PCCn_PCS_SHIFT));
+}
@@ -0,0 +1,73 @@
+/**
+ * @file hal_clock.h
+ * @author benecosta2711
+ * @brief A library contain function that read back the SCG and PCC configuration to compute
+ * the real clock frequencies used by the peripherals, instead of assuming a fixed value.
+ * Current version of this library support:
+ * - SOSC, SIRC, FIRC and SPLL source frequencies (0 when the source is not valid).
+ * - Asynchronous DIV2 outputs (SOSCDIV2, SIRCDIV2, FIRCDIV2, SPLLDIV2).
+ * - Functional clock of a peripheral selected by PCC[PCS].
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#ifndef HAL_CLOCK_H_
+#define HAL_CLOCK_H_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "S32K144.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/**
+ * @brief Frequency of the external crystal on the board (SOSC).
+ */
+#define HAL_CLOCK_SOSC_FREQ         8000000UL
+
+/**
+ * @brief Frequencies of the internal oscillators.
+ */
+#define HAL_CLOCK_SIRC_HIGH_FREQ    8000000UL   /* SIRCCFG[RANGE] = 1 */
+#define HAL_CLOCK_SIRC_LOW_FREQ     2000000UL   /* SIRCCFG[RANGE] = 0 */
+#define HAL_CLOCK_FIRC_FREQ         48000000UL
+
+/**
+ * @brief Defines the PCC[PCS] peripheral clock source selection.
+ */
+typedef enum
+{
+    HAL_CLOCK_PCS_OFF       = 0U,
+    HAL_CLOCK_PCS_SOSCDIV2  = 1U,
+    HAL_CLOCK_PCS_SIRCDIV2  = 2U,
+    HAL_CLOCK_PCS_FIRCDIV2  = 3U,
+    HAL_CLOCK_PCS_SPLLDIV2  = 6U
+} hal_clock_pcs_t;
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+/**
+ * @brief Gets the frequency of a DIV2 asynchronous clock output.
+ *
+ * @param pcs The clock selected, same encoding as PCC[PCS].
+ * @return Frequency in Hz, 0 if the source or the divider is disabled.
+ */
+uint32_t HAL_CLOCK_GetDiv2Freq(hal_clock_pcs_t pcs);
+
+/**
+ * @brief Gets the functional clock frequency of a peripheral from its PCC register.
+ *
+ * @param pccIndex The PCC index of the peripheral (e.g., PCC_LPUART1_INDEX).
+ * @return Frequency in Hz, 0 if no valid clock is selected.
+ */
+uint32_t HAL_CLOCK_GetPeripheralFreq(uint32_t pccIndex);
+
+#endif /* HAL_CLOCK_H_ */
@@ -0,0 +1,236 @@
+/**
+ * @file hal_dma.c
+ * @author benecosta2711
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include "hal_dma.h"
+#include "hal_irq.h"
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+static void HAL_DMA_IRQHandler(uint32_t channel);
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+/**
+ * @brief Array to store registered callback functions for each DMA channel.
+ */
+static HAL_DMA_Callback_t s_dmaCallbacks[HAL_DMA_CHANNEL_COUNT];
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+void HAL_DMA_Init(void)
+{
+    /* Enable clock for DMAMUX, eDMA clock is enabled by default in SIM_PLATCGC */
+    IP_PCC->PCCn[PCC_DMAMUX_INDEX] |= PCC_PCCn_CGC_MASK;
+
+    /* Transfer errors of every channel are reported on the shared error vector */
+    HAL_IRQ_Enable(DMA_Error_IRQn);
+}
+
+uint8_t HAL_DMA_ConfigureChannel(uint32_t channel, uint8_t request, const hal_dma_transfer_t *transfer, HAL_DMA_Callback_t callback)
+{
+    uint8_t retVal = 1;
+    uint16_t csr_val = 0U;
+
+    if ((channel >= HAL_DMA_CHANNEL_COUNT) || (NULL == transfer) || (0U == transfer->count)
+        || (transfer->count > DMA_TCD_CITER_ELINKNO_CITER_MASK))
+    {
+        retVal = 0;
+    }
+    else
+    {
+        /* Make sure the channel is idle before touching its TCD */
+        IP_DMA->CERQ = DMA_CERQ_CERQ(channel);
+        IP_DMA->CDNE = DMA_CDNE_CDNE(channel);
+        IP_DMA->CINT = DMA_CINT_CINT(channel);
+        IP_DMA->CERR = DMA_CERR_CERR(channel);
+
+        s_dmaCallbacks[channel] = callback;
+
+        /* Route the request source to the channel */
+        IP_DMAMUX->CHCFG[channel] = 0U;
+        IP_DMAMUX->CHCFG[channel] = DMAMUX_CHCFG_SOURCE(request) | DMAMUX_CHCFG_ENBL_MASK;
+
+        /* One element per request (minor loop), 'count' requests per major loop */
+        IP_DMA->TCD[channel].SADDR = transfer->srcAddr;
+        IP_DMA->TCD[channel].SOFF = (uint16_t)transfer->srcOffset;
+        IP_DMA->TCD[channel].ATTR = DMA_TCD_ATTR_SSIZE(transfer->size) | DMA_TCD_ATTR_DSIZE(transfer->size);
+        IP_DMA->TCD[channel].NBYTES.MLNO = DMA_TCD_NBYTES_MLNO_NBYTES(1UL << (uint32_t)transfer->size);
+        IP_DMA->TCD[channel].SLAST = (uint32_t)transfer->srcLastAdjust;
+        IP_DMA->TCD[channel].DADDR = transfer->dstAddr;
+        IP_DMA->TCD[channel].DOFF = (uint16_t)transfer->dstOffset;
+        IP_DMA->TCD[channel].CITER.ELINKNO = DMA_TCD_CITER_ELINKNO_CITER(transfer->count);
+        IP_DMA->TCD[channel].DLASTSGA = (uint32_t)transfer->dstLastAdjust;
+        IP_DMA->TCD[channel].BITER.ELINKNO = DMA_TCD_BITER_ELINKNO_BITER(transfer->count);
+
+        csr_val = DMA_TCD_CSR_INTMAJOR_MASK;
+        if (transfer->halfInterrupt != 0U)
+        {
+            csr_val |= DMA_TCD_CSR_INTHALF_MASK;
+        }
+        else
+        {
+            /* Do nothing */
+        }
+
+        if (transfer->stopOnComplete != 0U)
+        {
+            csr_val |= DMA_TCD_CSR_DREQ_MASK;
+        }
+        else
+        {
+            /* Do nothing */
+        }
+        IP_DMA->TCD[channel].CSR = csr_val;
+
+        IP_DMA->SEEI = DMA_SEEI_SEEI(channel);
+
+        /* DMA channel n transfer complete IRQ number is n */
+        HAL_IRQ_Enable((IRQn_Type)channel);
+    }
+
+    return retVal;
+}
+
+void HAL_DMA_StartChannel(uint32_t channel)
+{
+    if (channel < HAL_DMA_CHANNEL_COUNT)
+    {
+        IP_DMA->SERQ = DMA_SERQ_SERQ(channel);
+    }
+    else
+    {
+        /* Do nothing */
+    }
+}
+
+void HAL_DMA_StopChannel(uint32_t channel)
+{
+    if (channel < HAL_DMA_CHANNEL_COUNT)
+    {
+        IP_DMA->CERQ = DMA_CERQ_CERQ(channel);
+    }
+    else
+    {
+        /* Do nothing */
+    }
+}
+
+uint32_t HAL_DMA_GetRemainingCount(uint32_t channel)
+{
+    uint32_t count = 0U;
+
+    if (channel < HAL_DMA_CHANNEL_COUNT)
+    {
+        /* CITER is reloaded from BITER when the major loop completes, DONE tells them apart */
+        if ((IP_DMA->TCD[channel].CSR & DMA_TCD_CSR_DONE_MASK) == 0U)
+        {
+            count = (uint32_t)(IP_DMA->TCD[channel].CITER.ELINKNO & DMA_TCD_CITER_ELINKNO_CITER_MASK);
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }
+    else
+    {
+        /* Do nothing */
+    }
+
+    return count;
+}
+
+/**
+ * @brief Common IRQ Handler for DMA channel transfer complete interrupts.
+ */
+static void HAL_DMA_IRQHandler(uint32_t channel)
+{
+    uint32_t events = 0U;
+
+    if (channel < HAL_DMA_CHANNEL_COUNT)
+    {
+        IP_DMA->CINT = DMA_CINT_CINT(channel);
+
+        if ((IP_DMA->TCD[channel].CSR & DMA_TCD_CSR_DONE_MASK) != 0U)
+        {
+            events |= HAL_DMA_EVENT_MAJOR_COMPLETE;
+        }
+        else
+        {
+            events |= HAL_DMA_EVENT_HALF_COMPLETE;
+        }
+
+        if (s_dmaCallbacks[channel] != NULL)
+        {
+            s_dmaCallbacks[channel](channel, events);
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }
+    else
+    {
+        /* Do nothing */
+    }
+}
+
+/* Specific IRQ Handlers for each DMA channel */
+void DMA0_IRQHandler(void)  { HAL_DMA_IRQHandler(0U); }
+void DMA1_IRQHandler(void)  { HAL_DMA_IRQHandler(1U); }
+void DMA2_IRQHandler(void)  { HAL_DMA_IRQHandler(2U); }
+void DMA3_IRQHandler(void)  { HAL_DMA_IRQHandler(3U); }
+void DMA4_IRQHandler(void)  { HAL_DMA_IRQHandler(4U); }
+void DMA5_IRQHandler(void)  { HAL_DMA_IRQHandler(5U); }
+void DMA6_IRQHandler(void)  { HAL_DMA_IRQHandler(6U); }
+void DMA7_IRQHandler(void)  { HAL_DMA_IRQHandler(7U); }
+void DMA8_IRQHandler(void)  { HAL_DMA_IRQHandler(8U); }
+void DMA9_IRQHandler(void)  { HAL_DMA_IRQHandler(9U); }
+void DMA10_IRQHandler(void) { HAL_DMA_IRQHandler(10U); }
+void DMA11_IRQHandler(void) { HAL_DMA_IRQHandler(11U); }
+void DMA12_IRQHandler(void) { HAL_DMA_IRQHandler(12U); }
+void DMA13_IRQHandler(void) { HAL_DMA_IRQHandler(13U); }
+void DMA14_IRQHandler(void) { HAL_DMA_IRQHandler(14U); }
+void DMA15_IRQHandler(void) { HAL_DMA_IRQHandler(15U); }
+
+/**
+ * @brief Shared error IRQ Handler, stops every faulty channel and reports the error.
+ */
+void DMA_Error_IRQHandler(void)
+{
+    uint32_t err = IP_DMA->ERR;
+    uint32_t channel = 0U;
+
+    for (channel = 0U; channel < HAL_DMA_CHANNEL_COUNT; channel++)
+    {
+        if ((err & (1UL << channel)) != 0U)
+        {
+            IP_DMA->CERQ = DMA_CERQ_CERQ(channel);
+            IP_DMA->CERR = DMA_CERR_CERR(channel);
+
+            if (s_dmaCallbacks[channel] != NULL)
+            {
+                s_dmaCallbacks[channel](channel, HAL_DMA_EVENT_ERROR);
+            }
+            else
+            {
+                /* Do nothing */
+            }
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }
+}
@@ -0,0 +1,133 @@
+/**
+ * @file hal_dma.h
+ * @author benecosta2711
+ * @brief A library contain function that configure the eDMA and DMAMUX peripheral registers for moving
+ * data between memory and peripherals without CPU involvement.
+ * Current version of this library support:
+ * - Routing a DMAMUX request source to any of the 16 eDMA channels.
+ * - Basic single TCD transfer: one minor loop of one element per request, major loop of 'count' elements.
+ * - Major loop complete, half complete and error events through a per-channel callback.
+ * - Reading back the live progress of a channel (CITER).
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#ifndef HAL_DMA_H_
+#define HAL_DMA_H_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "S32K144.h"
+#include "stddef.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/**
+ * @brief Number of eDMA channels.
+ */
+#define HAL_DMA_CHANNEL_COUNT           16U
+
+/**
+ * @brief DMAMUX request sources used by this project (see S32K144 DMAMUX mapping).
+ */
+#define HAL_DMA_REQ_LPUART0_RX          2U
+#define HAL_DMA_REQ_LPUART0_TX          3U
+#define HAL_DMA_REQ_LPUART1_RX          4U
+#define HAL_DMA_REQ_LPUART1_TX          5U
+#define HAL_DMA_REQ_LPUART2_RX          6U
+#define HAL_DMA_REQ_LPUART2_TX          7U
+
+/**
+ * @brief Defines HAL DMA events passed to the channel callback.
+ */
+#define HAL_DMA_EVENT_MAJOR_COMPLETE    (1UL << 0)  /* Major loop completed */
+#define HAL_DMA_EVENT_HALF_COMPLETE     (1UL << 1)  /* Major loop half completed */
+#define HAL_DMA_EVENT_ERROR             (1UL << 2)  /* Transfer error, channel stopped */
+
+/**
+ * @brief Defines the size of one element moved per DMA request.
+ */
+typedef enum
+{
+    HAL_DMA_SIZE_8BIT  = 0U,
+    HAL_DMA_SIZE_16BIT = 1U,
+    HAL_DMA_SIZE_32BIT = 2U
+} hal_dma_size_t;
+
+/**
+ * @brief Structure describing a DMA transfer.
+ * One element of 'size' is moved per hardware request, 'count' requests complete the major loop.
+ */
+typedef struct
+{
+    uint32_t srcAddr;               /* Source address */
+    int16_t srcOffset;              /* Added to source address after each element */
+    int32_t srcLastAdjust;          /* Added to source address after the major loop */
+    uint32_t dstAddr;               /* Destination address */
+    int16_t dstOffset;              /* Added to destination address after each element */
+    int32_t dstLastAdjust;          /* Added to destination address after the major loop */
+    hal_dma_size_t size;            /* Element size */
+    uint16_t count;                 /* Number of elements, 1..32767 */
+    uint8_t halfInterrupt;          /* Raise HAL_DMA_EVENT_HALF_COMPLETE */
+    uint8_t stopOnComplete;         /* Clear the hardware request enable when the major loop completes */
+} hal_dma_transfer_t;
+
+/**
+ * @brief Defines the callback function pointer type for DMA events.
+ * The 'event' parameter will be a bitmask of HAL_DMA_EVENT_*.
+ */
+typedef void (*HAL_DMA_Callback_t)(uint32_t channel, uint32_t event);
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+/**
+ * @brief Initializes the eDMA and DMAMUX modules.
+ * Enables the DMAMUX clock and the eDMA error interrupt.
+ */
+void HAL_DMA_Init(void);
+
+/**
+ * @brief Configures a DMA channel for a transfer.
+ * The channel hardware request is left disabled, call HAL_DMA_StartChannel to start.
+ *
+ * @param channel The eDMA channel (0..15).
+ * @param request The DMAMUX request source (e.g., HAL_DMA_REQ_LPUART1_TX).
+ * @param transfer Pointer to the transfer description.
+ * @param callback The callback function to be called on channel events, may be NULL.
+ * @return 1 if configuration is successful, 0 otherwise.
+ */
+uint8_t HAL_DMA_ConfigureChannel(uint32_t channel, uint8_t request, const hal_dma_transfer_t *transfer, HAL_DMA_Callback_t callback);
+
+/**
+ * @brief Enables the hardware request of a DMA channel.
+ *
+ * @param channel The eDMA channel.
+ */
+void HAL_DMA_StartChannel(uint32_t channel);
+
+/**
+ * @brief Disables the hardware request of a DMA channel.
+ * A minor loop in progress is completed by the hardware.
+ *
+ * @param channel The eDMA channel.
+ */
+void HAL_DMA_StopChannel(uint32_t channel);
+
+/**
+ * @brief Gets the number of elements not yet moved in the current major loop.
+ * Read back from the channel CITER, returns 0 once the major loop is done.
+ *
+ * @param channel The eDMA channel.
+ * @return Remaining element count.
+ */
+uint32_t HAL_DMA_GetRemainingCount(uint32_t channel);
+
+#endif /* HAL_DMA_H_ */
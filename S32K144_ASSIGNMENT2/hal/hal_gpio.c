@@ -1,22 +1,24 @@
 #include "hal_gpio.h"
-#include "my_nvic.h"
+#include "hal_irq.h"
 
 /*******************************************************************************
  * Definitions
  ******************************************************************************/
 
-/* Định nghĩa các pin ảo được sử dụng trong dự án */
-#define PIN_LED_BLUE            0U
-#define PIN_LED_RED             1U
-#define PIN_LED_GREEN           2U
+/* Các pin ảo PIN_* được sinh từ BOARD_PIN_TABLE trong board_pins.h */
 
 /* Tổng số pin ảo được quản lý bởi HAL */
 #define HAL_VIRTUAL_PIN_COUNT   (sizeof(s_pinMap) / sizeof(pin_map_t))
 
+/*
+ * Cập nhật một port có cả bit set và bit clear bằng một lần ghi PDOR (đọc-sửa-ghi) trong
+ * vùng găng của hal_irq, các ISR có thể ghi GPIO đều ở mức ưu tiên bị che nên không bị mất.
+ */
+
 /*******************************************************************************
  * Prototypes
  ******************************************************************************/
-/* Không có hàm static nội bộ */
+static void HAL_GPIO_DispatchPort(uint32_t port_index, PORT_Type *port, const GPIO_Type *gpio);
 
 /*******************************************************************************
  * Variables
@@ -26,11 +28,22 @@
  * @brief Bảng ánh xạ từ pin ảo sang thông tin phần cứng.
  */
 static const pin_map_t s_pinMap[] = {
-	[PIN_LED_BLUE]   = {IP_PORTD, IP_PTD, 0U, PCC_PORTD_INDEX, PORTD_IRQn},
-    [PIN_LED_RED]   = {IP_PORTD, IP_PTD, 15U, PCC_PORTD_INDEX, PORTD_IRQn},
-    [PIN_LED_GREEN] = {IP_PORTD, IP_PTD, 16U, PCC_PORTD_INDEX, PORTD_IRQn}
+    BOARD_PIN_TABLE(BOARD_PIN_MAP_ENTRY)
 };
 
+/**
+ * @brief Bảng tra ngược từ (port, chân vật lý) sang pin ảo cộng 1, 0 nếu chân không được quản lý.
+ * Được sinh lúc biên dịch từ cùng bảng với s_pinMap, ISR không phải duyệt s_pinMap.
+ */
+static const uint8_t s_pinReverseMap[HAL_GPIO_PORT_COUNT][32] = {
+    BOARD_PIN_TABLE(BOARD_PIN_REVERSE_ENTRY)
+};
+
+/**
+ * @brief Loại trigger đã cấu hình cho từng pin ảo, dùng để báo sự kiện trong ISR.
+ */
+static uint8_t s_pinTrigger[sizeof(s_pinMap) / sizeof(pin_map_t)];
+
 /**
  * @brief Mảng lưu trữ các con trỏ hàm callback.
  * Khai báo là 'static' để bảo vệ dữ liệu, chỉ truy cập qua API.
@@ -122,6 +135,111 @@ void HAL_GPIO_WritePin(uint32_t virtual_pin, uint8_t value)
     }
 }
 
+uint8_t HAL_GPIO_InitGroup(hal_gpio_group_t *group, const uint32_t *virtual_pins, uint32_t count)
+{
+    uint8_t retVal = true;
+    GPIO_Type * gpio = NULL;
+    uint32_t i = 0U;
+    uint32_t port = 0U;
+
+    if ((NULL == group) || (NULL == virtual_pins) || (0U == count) || (count > HAL_GPIO_GROUP_MAX_PINS))
+    {
+        retVal = false;
+    }
+    else
+    {
+        group->pin_count = 0U;
+        group->port_count = 0U;
+
+        for (i = 0U; (i < count) && (true == retVal); i++)
+        {
+            if (virtual_pins[i] >= HAL_VIRTUAL_PIN_COUNT)
+            {
+                retVal = false;
+            }
+            else
+            {
+                gpio = s_pinMap[virtual_pins[i]].gpio_base;
+
+                /* Tìm port trong nhóm, thêm mới nếu chưa có */
+                for (port = 0U; (port < group->port_count) && (group->gpio_base[port] != gpio); port++)
+                {
+                    /* Do nothing */
+                }
+
+                if (port == group->port_count)
+                {
+                    group->gpio_base[port] = gpio;
+                    group->port_count++;
+                }
+                else
+                {
+                    /* Do nothing */
+                }
+
+                group->port_index[i] = (uint8_t)port;
+                group->pin_mask[i] = (1UL << s_pinMap[virtual_pins[i]].pin_num);
+                group->pin_count++;
+            }
+        }
+    }
+
+    return retVal;
+}
+
+void HAL_GPIO_WriteGroup(const hal_gpio_group_t *group, uint32_t mask, uint32_t values)
+{
+    uint32_t setMask[HAL_GPIO_PORT_COUNT] = {0U};
+    uint32_t clearMask[HAL_GPIO_PORT_COUNT] = {0U};
+    uint32_t i = 0U;
+    uint32_t irqState = 0U;
+    GPIO_Type * gpio = NULL;
+
+    if (NULL != group)
+    {
+        /* Gom các pin theo port */
+        for (i = 0U; i < group->pin_count; i++)
+        {
+            if ((mask & (1UL << i)) != 0U)
+            {
+                if ((values & (1UL << i)) != 0U)
+                {
+                    setMask[group->port_index[i]] |= group->pin_mask[i];
+                }
+                else
+                {
+                    clearMask[group->port_index[i]] |= group->pin_mask[i];
+                }
+            }
+        }
+
+        /* Mỗi port một lần ghi */
+        for (i = 0U; i < group->port_count; i++)
+        {
+            gpio = group->gpio_base[i];
+
+            if ((setMask[i] != 0U) && (clearMask[i] != 0U))
+            {
+                HAL_IRQ_ENTER_CRITICAL(irqState);
+                gpio->PDOR = (gpio->PDOR & ~clearMask[i]) | setMask[i];
+                HAL_IRQ_EXIT_CRITICAL(irqState);
+            }
+            else if (setMask[i] != 0U)
+            {
+                gpio->PSOR = setMask[i];
+            }
+            else if (clearMask[i] != 0U)
+            {
+                gpio->PCOR = clearMask[i];
+            }
+            else
+            {
+                /* Do nothing */
+            }
+        }
+    }
+}
+
 void HAL_GPIO_TogglePin(uint32_t virtual_pin)
 {
     if (virtual_pin < HAL_VIRTUAL_PIN_COUNT)
@@ -238,6 +356,8 @@ void HAL_GPIO_SetEventTrigger(uint32_t virtual_pin, hal_gpio_interrupt_trigger_t
                 break;
         }
 
+        s_pinTrigger[virtual_pin] = (uint8_t)trigger;
+
         pcr_val = port->PCR[physical_pin] & ~PORT_PCR_IRQC_MASK;
         pcr_val |= PORT_PCR_IRQC(irqc_value);
         port->PCR[physical_pin] = pcr_val;
@@ -246,11 +366,11 @@ void HAL_GPIO_SetEventTrigger(uint32_t virtual_pin, hal_gpio_interrupt_trigger_t
 
         if (trigger != HAL_GPIO_TRIGGER_NONE)
         {
-            NVIC->ISER[(uint32_t)s_pinMap[virtual_pin].irq_num >> 5U] = (1UL << ((uint32_t)s_pinMap[virtual_pin].irq_num & 0x1FUL));
+            HAL_IRQ_Enable(s_pinMap[virtual_pin].irq_num);
         }
         else
         {
-            NVIC->ICER[(uint32_t)s_pinMap[virtual_pin].irq_num >> 5U] = (1UL << ((uint32_t)s_pinMap[virtual_pin].irq_num & 0x1FUL));
+            HAL_IRQ_Disable(s_pinMap[virtual_pin].irq_num);
         }
     }
 }
@@ -279,6 +399,78 @@ void HAL_GPIO_ClearInterruptFlag(uint32_t virtual_pin)
     }
 }
 
+/**
+ * @brief Xử lý ngắt chung của một port.
+ * Đọc ISFR một lần, xóa tất cả các cờ đã đọc bằng một lần ghi, rồi duyệt các bit được set
+ * bằng CLZ. Thời gian xử lý chỉ phụ thuộc số chân có cờ, không phụ thuộc số chân được cấu hình.
+ *
+ * @param port_index Chỉ số port (BOARD_PORT_INDEX_*).
+ * @param port Thanh ghi PORT của port.
+ * @param gpio Thanh ghi GPIO của port, dùng để xác định cạnh khi trigger là cả hai cạnh.
+ */
+static void HAL_GPIO_DispatchPort(uint32_t port_index, PORT_Type *port, const GPIO_Type *gpio)
+{
+    uint32_t flags = port->ISFR;
+    uint32_t physical_pin = 0U;
+    uint32_t virtual_pin = 0U;
+    uint32_t event = 0U;
+
+    /* Xóa trước khi gọi callback để cạnh mới xảy ra trong callback vẫn được ghi nhận */
+    port->ISFR = flags;
+
+    while (flags != 0U)
+    {
+        physical_pin = 31U - (uint32_t)__builtin_clz(flags);
+        flags &= ~(1UL << physical_pin);
+
+        virtual_pin = s_pinReverseMap[port_index][physical_pin];
+
+        if ((virtual_pin != 0U) && (s_gpioCallbacks[virtual_pin - 1U] != NULL))
+        {
+            virtual_pin--;
+            event = s_pinTrigger[virtual_pin];
+
+            /* Với trigger cả hai cạnh, mức hiện tại cho biết cạnh vừa xảy ra */
+            if (HAL_GPIO_TRIGGER_EITHER_EDGE == event)
+            {
+                event = ((gpio->PDIR & (1UL << physical_pin)) != 0U) ? HAL_GPIO_TRIGGER_RISING_EDGE
+                                                                      : HAL_GPIO_TRIGGER_FALLING_EDGE;
+            }
+            else
+            {
+                /* Do nothing */
+            }
+
+            s_gpioCallbacks[virtual_pin](virtual_pin, event);
+        }
+        else
+        {
+            /* Do nothing, chân không được quản lý hoặc chưa đăng ký callback */
+        }
+    }
+}
+
+void PORTA_IRQHandler(void)
+{
+    HAL_GPIO_DispatchPort(BOARD_PORT_INDEX_A, IP_PORTA, IP_PTA);
+}
+
+void PORTB_IRQHandler(void)
+{
+    HAL_GPIO_DispatchPort(BOARD_PORT_INDEX_B, IP_PORTB, IP_PTB);
+}
+
+void PORTC_IRQHandler(void)
+{
+    HAL_GPIO_DispatchPort(BOARD_PORT_INDEX_C, IP_PORTC, IP_PTC);
+}
+
+void PORTD_IRQHandler(void)
+{
+    HAL_GPIO_DispatchPort(BOARD_PORT_INDEX_D, IP_PORTD, IP_PTD);
+}
+
 void PORTE_IRQHandler(void)
 {
+    HAL_GPIO_DispatchPort(BOARD_PORT_INDEX_E, IP_PORTE, IP_PTE);
 }
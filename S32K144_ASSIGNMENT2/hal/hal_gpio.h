@@ -5,6 +5,7 @@
  * Includes
  ******************************************************************************/
 #include "S32K144.h"
+#include "board_pins.h"
 #include "stddef.h"
 
 /*******************************************************************************
@@ -65,6 +66,25 @@ typedef struct
     IRQn_Type irq_num;
 } pin_map_t;
 
+/**
+ * @brief Số pin tối đa của một nhóm và số port GPIO (PTA đến PTE)
+ */
+#define HAL_GPIO_GROUP_MAX_PINS     8U
+#define HAL_GPIO_PORT_COUNT         5U
+
+/**
+ * @brief Nhóm pin ảo được ghi cùng lúc, bit i của mask/values ứng với pin thứ i của nhóm.
+ * Thông tin port và mặt nạ vật lý của từng pin được tính sẵn khi khởi tạo nhóm.
+ */
+typedef struct
+{
+    GPIO_Type *gpio_base[HAL_GPIO_PORT_COUNT];      /* Các port có pin thuộc nhóm */
+    uint32_t pin_mask[HAL_GPIO_GROUP_MAX_PINS];     /* Mặt nạ vật lý của từng pin */
+    uint8_t port_index[HAL_GPIO_GROUP_MAX_PINS];    /* Vị trí port của từng pin trong gpio_base */
+    uint8_t pin_count;
+    uint8_t port_count;
+} hal_gpio_group_t;
+
 /**
  * @brief Định nghĩa kiểu con trỏ hàm callback
  */
@@ -107,6 +127,27 @@ void HAL_GPIO_SetDirection(uint32_t virtual_pin, hal_gpio_direction_t dir);
  */
 void HAL_GPIO_WritePin(uint32_t virtual_pin, uint8_t value);
 
+/**
+ * @brief Khởi tạo một nhóm pin ảo để ghi cùng lúc bằng HAL_GPIO_WriteGroup.
+ *
+ * @param group Nhóm cần khởi tạo.
+ * @param virtual_pins Danh sách pin ảo, pin thứ i ứng với bit i của mask/values.
+ * @param count Số pin (1 đến HAL_GPIO_GROUP_MAX_PINS).
+ * @return true nếu thành công, false nếu tham số hoặc pin không hợp lệ.
+ */
+uint8_t HAL_GPIO_InitGroup(hal_gpio_group_t *group, const uint32_t *virtual_pins, uint32_t count);
+
+/**
+ * @brief Ghi nhiều chân Output của một nhóm cùng lúc.
+ * Các chân trên cùng một port được cập nhật bằng một lần ghi duy nhất nên không có
+ * trạng thái trung gian (ví dụ màu lẫn trên đèn RGB).
+ *
+ * @param group Nhóm đã khởi tạo.
+ * @param mask Các pin trong nhóm cần ghi (bit i ứng với pin thứ i).
+ * @param values Giá trị cần ghi cho các pin trong mask (bit = 1 cho HIGH).
+ */
+void HAL_GPIO_WriteGroup(const hal_gpio_group_t *group, uint32_t mask, uint32_t values);
+
 /**
  * @brief Đảo trạng thái của một chân Output.
  *
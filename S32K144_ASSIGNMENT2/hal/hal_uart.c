@@ -9,7 +9,10 @@
  */
 
 #include "hal_uart.h"
-#include "my_nvic.h"
+#include "hal_irq.h"
+#include "hal_dma.h"
+#include "hal_clock.h"
+#include "time_base.h"
 
 /*******************************************************************************
  * Definitions
@@ -31,18 +34,78 @@ typedef struct
     const uint32_t          rxPin;              /* Pin number for RX */
     const uint32_t          rxPinMux;           /* MUX setting for RX pin */
     const uint32_t          rxPccIndex;         /* PCC clock gate index for RX PORT */
+    const uint32_t          txDmaChannel;       /* eDMA channel used for TX */
+    const uint8_t           txDmaRequest;       /* DMAMUX request source for TX */
+    const uint32_t          rxDmaChannel;       /* eDMA channel used for RX */
+    const uint8_t           rxDmaRequest;       /* DMAMUX request source for RX */
 } uart_map_t;
 
 /**
- * @brief Assumed clock source frequency for LPUART module.
- * This example assumes SIRCDIV2 is used.
- * The default SOSC frequency is 8 MHz.
+ * @brief Transfer state of one UART instance.
+ * Every instance owns its buffers and counters, so transfers running on
+ * different ports at the same time never touch each other's data.
  */
-#define LPUART_MODULE_CLOCK_FREQ    8000000UL
+typedef struct
+{
+    HAL_UART_Callback_t     callback;           /* Registered event callback */
+
+    /* Block transfer, moved by the ISR or by eDMA */
+    const uint8_t *         txBuffer;           /* Data being sent */
+    uint32_t                txLength;           /* Number of bytes to send */
+    volatile uint32_t       txCount;            /* Number of bytes sent */
+    volatile uint8_t        txBusy;             /* A block send is running */
+    uint8_t                 txDma;              /* The running send is moved by eDMA */
+    uint8_t *               rxBuffer;           /* Destination of the data received */
+    uint32_t                rxLength;           /* Number of bytes to receive */
+    volatile uint32_t       rxCount;            /* Number of bytes received */
+    volatile uint8_t        rxBusy;             /* A block receive is running */
+    uint8_t                 rxDma;              /* The running receive is moved by eDMA */
+
+    /* Buffered mode: RX is produced by the ISR, TX is consumed by the ISR */
+    ring_buffer_t           rxRing;
+    ring_buffer_t           txRing;
+    uint8_t                 rxRingStorage[HAL_UART_RX_RING_SIZE];
+    uint8_t                 txRingStorage[HAL_UART_TX_RING_SIZE];
+    volatile uint8_t        rxBuffered;         /* Buffered reception is running */
+    HAL_UART_RxHandler_t    rxHandler;          /* Per-byte receive hook, called from the ISR */
+
+    /* FIFO mode, a depth of 0 means the FIFOs are disabled */
+    uint32_t                fifoDepth;
+    hal_uart_fifo_config_t  fifoConfig;
+
+    volatile uint32_t       irqCount;           /* Number of interrupts served */
+
+    hal_uart_baud_info_t    baudInfo;           /* Result of the last baud rate solve */
+} uart_state_t;
+
+/**
+ * @brief Range of the LPUART oversampling ratio and baud rate modulo divisor.
+ * BOTHEDGE sampling is required for an oversampling ratio below 8.
+ */
+#define LPUART_OSR_MIN              4U
+#define LPUART_OSR_MAX              32U
+#define LPUART_OSR_BOTHEDGE_MAX     7U
+#define LPUART_SBR_MAX              8191U
+
+/**
+ * @brief STAT flags cleared by writing 1. A read-modify-write of STAT would clear every one
+ * of them that is set, so they are written as 0 except the flag being cleared.
+ */
+#define HAL_UART_STAT_W1C_MASK      (LPUART_STAT_LBKDIF_MASK | LPUART_STAT_RXEDGIF_MASK | LPUART_STAT_IDLE_MASK \
+                                   | LPUART_STAT_OR_MASK | LPUART_STAT_NF_MASK | LPUART_STAT_FE_MASK \
+                                   | LPUART_STAT_PF_MASK | LPUART_STAT_MA1F_MASK | LPUART_STAT_MA2F_MASK)
+
+/* Total number of UART instances managed by HAL */
+#define HAL_UART_INSTANCE_COUNT     (sizeof(s_uartMap) / sizeof(uart_map_t))
 
 /*******************************************************************************
  * Prototypes
  ******************************************************************************/
+static uint32_t HAL_UART_FillTx(uint32_t instance);
+static uint32_t HAL_UART_DrainRx(uint32_t instance);
+static void HAL_UART_ClearStatusFlags(LPUART_Type * base, uint32_t flags);
+static void HAL_UART_DmaCallback(uint32_t channel, uint32_t event);
+static uint8_t HAL_UART_SolveBaud(uint32_t clockFreq, uint32_t baudRate, hal_uart_baud_info_t *info);
 
 
 /*******************************************************************************
@@ -65,7 +128,11 @@ static const uart_map_t s_uartMap[] = {
         .rxPort = IP_PORTB,
         .rxPin = 0,
         .rxPinMux = 2U,
-        .rxPccIndex = PCC_PORTB_INDEX
+        .rxPccIndex = PCC_PORTB_INDEX,
+        .txDmaChannel = 0U,
+        .txDmaRequest = HAL_DMA_REQ_LPUART0_TX,
+        .rxDmaChannel = 1U,
+        .rxDmaRequest = HAL_DMA_REQ_LPUART0_RX
     },
     /* Instance HAL_LPUART1: Maps to LPUART1, Pins PTC6 (Rx) and PTC7 (Tx) */
     {
@@ -79,7 +146,11 @@ static const uart_map_t s_uartMap[] = {
         .rxPort = IP_PORTC,
         .rxPin = 6U,
         .rxPinMux = 2U,
-        .rxPccIndex = PCC_PORTC_INDEX
+        .rxPccIndex = PCC_PORTC_INDEX,
+        .txDmaChannel = 2U,
+        .txDmaRequest = HAL_DMA_REQ_LPUART1_TX,
+        .rxDmaChannel = 3U,
+        .rxDmaRequest = HAL_DMA_REQ_LPUART1_RX
     },
     /* Instance HAL_LPUART2: Maps to LPUART2, Pins PTA8 (Rx) and PTA9 (Tx) */
     {
@@ -93,23 +164,19 @@ static const uart_map_t s_uartMap[] = {
         .rxPort = IP_PORTA,
         .rxPin = 8U,
         .rxPinMux = 2U,
-        .rxPccIndex = PCC_PORTA_INDEX
+        .rxPccIndex = PCC_PORTA_INDEX,
+        .txDmaChannel = 4U,
+        .txDmaRequest = HAL_DMA_REQ_LPUART2_TX,
+        .rxDmaChannel = 5U,
+        .rxDmaRequest = HAL_DMA_REQ_LPUART2_RX
     }
 };
 
-volatile uint8_t* g_txBuffer = NULL;
-volatile uint32_t g_txBufferCount = 0;
-volatile uint32_t g_txBufferLength = 0;
-
-volatile uint8_t* g_rxBuffer = NULL;
-volatile uint32_t g_rxBufferCount = 0;
-volatile uint32_t g_rxBufferLength = 0;
-
-
 /**
- * @brief Array to store registered callback functions for each UART instance.
+ * @brief Transfer state of each UART instance.
  */
-static HAL_UART_Callback_t s_uartCallbacks[sizeof(s_uartMap) / sizeof(uart_map_t)];
+static uart_state_t s_uartState[HAL_UART_INSTANCE_COUNT];
+
 /*******************************************************************************
  * Code
  ******************************************************************************/
@@ -120,7 +187,8 @@ uint8_t HAL_UART_Init(uint32_t instance)
     const uart_map_t * map = NULL;
     uint32_t pcr_val = 0U;
 
-    if (instance >= (sizeof(s_uartMap) / sizeof(uart_map_t)))
+    /* Without a running time base every timeout would spin forever */
+    if ((instance >= HAL_UART_INSTANCE_COUNT) || (0U == time_get_freq()))
     {
         retVal = 0;
     }
@@ -149,6 +217,97 @@ uint8_t HAL_UART_Init(uint32_t instance)
 
         /* Enable clock for LPUART peripheral */
         IP_PCC->PCCn[map->pccIndex] |= PCC_PCCn_CGC_MASK;
+
+        /* Prepare ring buffers for buffered mode */
+        s_uartState[instance].rxBuffered = 0U;
+        s_uartState[instance].rxHandler = NULL;
+        (void)RingBuffer_Init(&s_uartState[instance].rxRing, s_uartState[instance].rxRingStorage, HAL_UART_RX_RING_SIZE);
+        (void)RingBuffer_Init(&s_uartState[instance].txRing, s_uartState[instance].txRingStorage, HAL_UART_TX_RING_SIZE);
+
+        s_uartState[instance].txBusy = 0U;
+        s_uartState[instance].rxBusy = 0U;
+        s_uartState[instance].txCount = 0U;
+        s_uartState[instance].rxCount = 0U;
+    }
+
+    return retVal;
+}
+
+/**
+ * @brief Searches OSR 4..32 and SBR for the baud rate closest to the requested one.
+ * On a tie the higher OSR is kept, it samples each bit more times.
+ *
+ * @param clockFreq The LPUART functional clock in Hz.
+ * @param baudRate The requested baud rate.
+ * @param info Pointer to store the selected divisors, achieved baud and error.
+ * @return 1 if the error is within HAL_UART_BAUD_TOLERANCE, 0 otherwise.
+ */
+static uint8_t HAL_UART_SolveBaud(uint32_t clockFreq, uint32_t baudRate, hal_uart_baud_info_t *info)
+{
+    uint8_t retVal = 0;
+    uint32_t osr = 0U;
+    uint32_t sbr = 0U;
+    uint32_t divisor = 0U;
+    uint32_t actual = 0U;
+    uint32_t diff = 0U;
+    uint32_t bestDiff = 0xFFFFFFFFUL;
+
+    info->osr = 0U;
+    info->sbr = 0U;
+    info->actualBaud = 0U;
+    info->errorX100 = 0xFFFFFFFFUL;
+
+    if ((0U != clockFreq) && (0U != baudRate))
+    {
+        for (osr = LPUART_OSR_MIN; osr <= LPUART_OSR_MAX; osr++)
+        {
+            /* Rounded SBR = clock / (baud * osr) */
+            divisor = baudRate * osr;
+            sbr = (clockFreq + (divisor / 2U)) / divisor;
+
+            if (0U == sbr)
+            {
+                sbr = 1U;
+            }
+            else if (sbr > LPUART_SBR_MAX)
+            {
+                sbr = LPUART_SBR_MAX;
+            }
+            else
+            {
+                /* Do nothing */
+            }
+
+            actual = clockFreq / (osr * sbr);
+            diff = (actual > baudRate) ? (actual - baudRate) : (baudRate - actual);
+
+            if (diff <= bestDiff)
+            {
+                bestDiff = diff;
+                info->osr = osr;
+                info->sbr = sbr;
+                info->actualBaud = actual;
+            }
+            else
+            {
+                /* Do nothing */
+            }
+        }
+
+        info->errorX100 = (uint32_t)(((uint64_t)bestDiff * 10000U) / baudRate);
+
+        if (info->errorX100 <= HAL_UART_BAUD_TOLERANCE)
+        {
+            retVal = 1;
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }
+    else
+    {
+        /* Do nothing */
     }
 
     return retVal;
@@ -158,37 +317,51 @@ uint8_t HAL_UART_Configure(uint32_t instance, const hal_uart_config_t *config)
 {
     uint8_t retVal = 1;
     LPUART_Type * base = NULL;
-    uint32_t sbr = 0U;
-    uint32_t osr = 16U;
+    hal_uart_baud_info_t * baudInfo = NULL;
+    uint32_t baud_val = 0U;
 
-    if (((sizeof(s_uartMap) / sizeof(uart_map_t)) <= instance) || (NULL == config))
+    if ((HAL_UART_INSTANCE_COUNT <= instance) || (NULL == config))
+    {
+        retVal = 0;
+    }
+    else if (HAL_UART_SolveBaud(HAL_CLOCK_GetPeripheralFreq(s_uartMap[instance].pccIndex),
+                                config->baudRate, &s_uartState[instance].baudInfo) == 0U)
     {
+        /* No OSR/SBR pair is close enough from the current functional clock */
         retVal = 0;
     }
     else
     {
         base = s_uartMap[instance].base;
+        baudInfo = &s_uartState[instance].baudInfo;
 
         /* Disable transmitter and receiver before configuration */
         base->CTRL &= ~(LPUART_CTRL_TE_MASK | LPUART_CTRL_RE_MASK);
 
-        /* Calculate and set Baud Rate */
-        sbr = LPUART_MODULE_CLOCK_FREQ / (config->baudRate * osr);
-        base->BAUD &= ~LPUART_BAUD_SBR_MASK;
-        base->BAUD |= LPUART_BAUD_SBR(sbr);
-        base->BAUD &= ~LPUART_BAUD_OSR_MASK;
-        base->BAUD |= LPUART_BAUD_OSR(osr - 1U);
+        /* Set Baud Rate, sample on both edges for low oversampling ratios */
+        baud_val = base->BAUD;
+        baud_val &= ~(LPUART_BAUD_SBR_MASK | LPUART_BAUD_OSR_MASK | LPUART_BAUD_BOTHEDGE_MASK | LPUART_BAUD_SBNS_MASK);
+        baud_val |= LPUART_BAUD_SBR(baudInfo->sbr) | LPUART_BAUD_OSR(baudInfo->osr - 1U);
+
+        if (baudInfo->osr <= LPUART_OSR_BOTHEDGE_MAX)
+        {
+            baud_val |= LPUART_BAUD_BOTHEDGE_MASK;
+        }
+        else
+        {
+            /* Do nothing */
+        }
 
         /* Configure Stop Bits */
-        base->BAUD &= ~LPUART_BAUD_SBNS_MASK;
         if (HAL_UART_STOP_BITS_2 == config->stopBits)
         {
-            base->BAUD |= LPUART_BAUD_SBNS(1U);
+            baud_val |= LPUART_BAUD_SBNS(1U);
         }
         else
         {
             /* Do nothing */
         }
+        base->BAUD = baud_val;
 
         /* Configure Parity and Data Bits */
         uint32_t ctrl_val = base->CTRL;
@@ -228,11 +401,20 @@ uint8_t HAL_UART_Configure(uint32_t instance, const hal_uart_config_t *config)
 
 void HAL_UART_Deinit(uint32_t instance)
 {
-    if (instance < (sizeof(s_uartMap) / sizeof(uart_map_t)))
+    if (instance < HAL_UART_INSTANCE_COUNT)
     {
         /* Disable interrupts, transmitter and receiver */
         s_uartMap[instance].base->CTRL = 0U;
 
+        /* Abort running DMA transfers */
+        s_uartMap[instance].base->BAUD &= ~(LPUART_BAUD_TDMAE_MASK | LPUART_BAUD_RDMAE_MASK);
+        HAL_DMA_StopChannel(s_uartMap[instance].txDmaChannel);
+        HAL_DMA_StopChannel(s_uartMap[instance].rxDmaChannel);
+        s_uartState[instance].txBusy = 0U;
+        s_uartState[instance].rxBusy = 0U;
+        s_uartState[instance].rxBuffered = 0U;
+        s_uartState[instance].rxHandler = NULL;
+
         /* Disable LPUART clock gate */
         IP_PCC->PCCn[s_uartMap[instance].pccIndex] &= ~PCC_PCCn_CGC_MASK;
     }
@@ -240,9 +422,9 @@ void HAL_UART_Deinit(uint32_t instance)
 
 void HAL_UART_RegisterCallback(uint32_t instance, HAL_UART_Callback_t callback)
 {
-    if (instance < (sizeof(s_uartMap) / sizeof(uart_map_t)))
+    if (instance < HAL_UART_INSTANCE_COUNT)
     {
-        s_uartCallbacks[instance] = callback;
+        s_uartState[instance].callback = callback;
     }
     else
     {
@@ -252,7 +434,7 @@ void HAL_UART_RegisterCallback(uint32_t instance, HAL_UART_Callback_t callback)
 
 void HAL_UART_SendByteBlocking(uint32_t instance, uint8_t data)
 {
-    if (instance < (sizeof(s_uartMap) / sizeof(uart_map_t)))
+    if (instance < HAL_UART_INSTANCE_COUNT)
     {
         /* Wait until transmit data register is empty */
         while ((s_uartMap[instance].base->STAT & LPUART_STAT_TDRE_MASK) == 0U) {}
@@ -266,11 +448,73 @@ void HAL_UART_SendByteBlocking(uint32_t instance, uint8_t data)
 
 }
 
+uint8_t HAL_UART_SendByteTimeout(uint32_t instance, uint8_t data, uint32_t timeoutUs)
+{
+    uint8_t retVal = 0U;
+    uint64_t deadline = 0U;
+
+    /* Fail fast if the time base is not running, "now" would never reach the deadline */
+    if ((instance < HAL_UART_INSTANCE_COUNT) && (0U != time_get_freq()))
+    {
+        deadline = time_now_us() + timeoutUs;
+
+        while (((s_uartMap[instance].base->STAT & LPUART_STAT_TDRE_MASK) == 0U)
+               && (time_now_us() < deadline)) {}
+
+        /* Check the flag again, it may be set right at the deadline */
+        if ((s_uartMap[instance].base->STAT & LPUART_STAT_TDRE_MASK) != 0U)
+        {
+            s_uartMap[instance].base->DATA = (uint8_t)data;
+            retVal = 1U;
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }
+    else
+    {
+        /* Do nothing */
+    }
+
+    return retVal;
+}
+
+uint8_t HAL_UART_ReadByteTimeout(uint32_t instance, uint8_t *data, uint32_t timeoutUs)
+{
+    uint8_t retVal = 0U;
+    uint64_t deadline = 0U;
+
+    if ((instance < HAL_UART_INSTANCE_COUNT) && (NULL != data) && (0U != time_get_freq()))
+    {
+        deadline = time_now_us() + timeoutUs;
+
+        while (((s_uartMap[instance].base->STAT & LPUART_STAT_RDRF_MASK) == 0U)
+               && (time_now_us() < deadline)) {}
+
+        if ((s_uartMap[instance].base->STAT & LPUART_STAT_RDRF_MASK) != 0U)
+        {
+            *data = (uint8_t)s_uartMap[instance].base->DATA;
+            retVal = 1U;
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }
+    else
+    {
+        /* Do nothing */
+    }
+
+    return retVal;
+}
+
 uint8_t HAL_UART_ReadByteBlocking(uint32_t instance)
 {
     uint8_t data = 0U;
 
-    if (instance < (sizeof(s_uartMap) / sizeof(uart_map_t)))
+    if (instance < HAL_UART_INSTANCE_COUNT)
     {
         /* Wait until receive data register is full */
         while ((s_uartMap[instance].base->STAT & LPUART_STAT_RDRF_MASK) == 0U) {}
@@ -289,7 +533,7 @@ void HAL_UART_EnableInterrupts(uint32_t instance, uint32_t interruptMask)
 {
     uint32_t ctrl_val = 0U;
 
-    if (instance < (sizeof(s_uartMap) / sizeof(uart_map_t)))
+    if (instance < HAL_UART_INSTANCE_COUNT)
     {
         ctrl_val = s_uartMap[instance].base->CTRL;
 
@@ -331,7 +575,7 @@ void HAL_UART_EnableInterrupts(uint32_t instance, uint32_t interruptMask)
 
         s_uartMap[instance].base->CTRL = ctrl_val;
 
-        NVIC->ISER[(uint32_t)s_uartMap[instance].irqNum >> 5U] = (1UL << ((uint32_t)s_uartMap[instance].irqNum & 0x1FUL));
+        HAL_IRQ_Enable(s_uartMap[instance].irqNum);
     }
     else
     {
@@ -343,7 +587,7 @@ void HAL_UART_DisableInterrupts(uint32_t instance, uint32_t interruptMask)
 {
     uint32_t ctrl_val = 0U;
 
-    if (instance < (sizeof(s_uartMap) / sizeof(uart_map_t)))
+    if (instance < HAL_UART_INSTANCE_COUNT)
     {
         ctrl_val = s_uartMap[instance].base->CTRL;
 
@@ -393,7 +637,7 @@ void HAL_UART_DisableInterrupts(uint32_t instance, uint32_t interruptMask)
 
 void HAL_UART_EnableTransmitter(uint32_t instance, uint8_t enable)
 {
-    if (instance < (sizeof(s_uartMap) / sizeof(uart_map_t)))
+    if (instance < HAL_UART_INSTANCE_COUNT)
     {
         if (enable)
         {
@@ -412,7 +656,7 @@ void HAL_UART_EnableTransmitter(uint32_t instance, uint8_t enable)
 
 void HAL_UART_EnableReceiver(uint32_t instance, uint8_t enable)
 {
-    if (instance < (sizeof(s_uartMap) / sizeof(uart_map_t)))
+    if (instance < HAL_UART_INSTANCE_COUNT)
     {
         if (enable)
         {
@@ -433,7 +677,7 @@ uint32_t HAL_UART_GetStatusFlags(uint32_t instance)
 {
     uint32_t stat_val = 0U;
 
-    if (instance < (sizeof(s_uartMap) / sizeof(uart_map_t)))
+    if (instance < HAL_UART_INSTANCE_COUNT)
     {
         stat_val = s_uartMap[instance].base->STAT;
     }
@@ -445,81 +689,744 @@ uint32_t HAL_UART_GetStatusFlags(uint32_t instance)
     return stat_val;
 }
 
-/**
- * @brief Common IRQ Handler for LPUART instances.
- * This function should be called from the specific IRQ handlers.
- */
-static void HAL_UART_IRQHandler(uint32_t instance)
+uint8_t HAL_UART_StartBufferedReceive(uint32_t instance)
 {
-    LPUART_Type* base = s_uartMap[instance].base;
-    uint32_t stat = 0U;
-    uint32_t events = 0U;
+    uint8_t retVal = 1;
+
+    if (instance >= HAL_UART_INSTANCE_COUNT)
+    {
+        retVal = 0;
+    }
+    else
+    {
+        s_uartState[instance].rxBuffered = 1U;
+        HAL_UART_EnableInterrupts(instance, HAL_UART_INT_RX_DATA_REG_FULL | HAL_UART_INT_RX_OVERRUN);
+    }
+
+    return retVal;
+}
+
+void HAL_UART_StopBufferedReceive(uint32_t instance)
+{
+    if (instance < HAL_UART_INSTANCE_COUNT)
+    {
+        HAL_UART_DisableInterrupts(instance, HAL_UART_INT_RX_DATA_REG_FULL | HAL_UART_INT_RX_OVERRUN);
+        s_uartState[instance].rxBuffered = 0U;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+}
 
+uint8_t HAL_UART_StartRxHandler(uint32_t instance, HAL_UART_RxHandler_t handler)
+{
+    uint8_t retVal = 1;
 
-    if (instance < (sizeof(s_uartMap) / sizeof(uart_map_t)))
+    if ((instance >= HAL_UART_INSTANCE_COUNT) || (NULL == handler))
     {
-    	stat = base->STAT;
+        retVal = 0;
+    }
+    else
+    {
+        s_uartState[instance].rxHandler = handler;
+        HAL_UART_EnableInterrupts(instance, HAL_UART_INT_RX_DATA_REG_FULL | HAL_UART_INT_RX_OVERRUN);
+    }
 
-        /* Check transmit data register empty*/
-        if(((stat & LPUART_STAT_TDRE_MASK) != 0U) && ((base->CTRL & LPUART_CTRL_TIE_MASK) != 0U))
-        {
-			if(g_txBufferCount < g_txBufferLength)
-			{
-				base->DATA = (uint32_t)g_txBuffer[g_txBufferCount];
-				g_txBufferCount++;
-			}
-			else
-			{
-				HAL_UART_DisableInterrupts(instance, HAL_UART_INT_TX_DATA_REG_EMPTY);
+    return retVal;
+}
+
+void HAL_UART_StopRxHandler(uint32_t instance)
+{
+    if (instance < HAL_UART_INSTANCE_COUNT)
+    {
+        HAL_UART_DisableInterrupts(instance, HAL_UART_INT_RX_DATA_REG_FULL | HAL_UART_INT_RX_OVERRUN);
+        s_uartState[instance].rxHandler = NULL;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+}
+
+uint32_t HAL_UART_ReadBuffered(uint32_t instance, uint8_t *data, uint32_t maxLength)
+{
+    uint32_t count = 0U;
+
+    if ((instance < HAL_UART_INSTANCE_COUNT) && (NULL != data))
+    {
+        count = RingBuffer_Read(&s_uartState[instance].rxRing, data, maxLength);
+    }
+    else
+    {
+        /* Do nothing */
+    }
 
-				/* Reset buffer resource */
-				g_txBuffer = NULL;
-				g_txBufferCount = 0;
-				g_txBufferLength = 0;
-				events |= ARM_USART_EVENT_SEND_COMPLETE;
-			}
+    return count;
+}
+
+uint32_t HAL_UART_WriteBuffered(uint32_t instance, const uint8_t *data, uint32_t length)
+{
+    uint32_t count = 0U;
+
+    if ((instance < HAL_UART_INSTANCE_COUNT) && (NULL != data))
+    {
+        count = RingBuffer_Write(&s_uartState[instance].txRing, data, length);
+
+        /* Data is published before TIE is set, so the ISR can never miss it */
+        if (count != 0U)
+        {
+            HAL_UART_EnableInterrupts(instance, HAL_UART_INT_TX_DATA_REG_EMPTY);
         }
         else
         {
-        	/* Do nothing */
+            /* Do nothing */
         }
+    }
+    else
+    {
+        /* Do nothing */
+    }
 
-        /* Check receive complete*/
-        if (((stat & LPUART_STAT_RDRF_MASK) != 0U) && ((base->CTRL & LPUART_CTRL_RIE_MASK) != 0U))
+    return count;
+}
+
+uint32_t HAL_UART_GetRxBufferedCount(uint32_t instance)
+{
+    uint32_t count = 0U;
+
+    if (instance < HAL_UART_INSTANCE_COUNT)
+    {
+        count = RingBuffer_GetCount(&s_uartState[instance].rxRing);
+    }
+    else
+    {
+        /* Do nothing */
+    }
+
+    return count;
+}
+
+uint8_t HAL_UART_ConfigureFifo(uint32_t instance, const hal_uart_fifo_config_t *config)
+{
+    uint8_t retVal = 1;
+    LPUART_Type * base = NULL;
+    uint32_t ctrl_val = 0U;
+    uint32_t depth = 0U;
+
+    if ((instance >= HAL_UART_INSTANCE_COUNT) || (NULL == config))
+    {
+        retVal = 0;
+    }
+    else
+    {
+        base = s_uartMap[instance].base;
+
+        /* FIFO depth is 2^PARAM[TXFIFO] words, watermarks must be lower */
+        depth = 1UL << ((base->PARAM & LPUART_PARAM_TXFIFO_MASK) >> LPUART_PARAM_TXFIFO_SHIFT);
+
+        if ((config->txWatermark >= depth) || (config->rxWatermark >= depth))
+        {
+            retVal = 0;
+        }
+        else
         {
-        	if(g_rxBuffer != NULL)
-        	{
-        		uint8_t dataByte = (uint8_t)base->DATA;
+            /* FIFO and WATER may only be changed while transmitter and receiver are disabled */
+            ctrl_val = base->CTRL;
+            base->CTRL = ctrl_val & ~(LPUART_CTRL_TE_MASK | LPUART_CTRL_RE_MASK);
+
+            base->WATER = LPUART_WATER_TXWATER(config->txWatermark)
+                        | LPUART_WATER_RXWATER(config->rxWatermark);
+
+            base->FIFO = LPUART_FIFO_TXFE_MASK
+                       | LPUART_FIFO_RXFE_MASK
+                       | LPUART_FIFO_RXIDEN(config->rxIdle)
+                       | LPUART_FIFO_TXFLUSH_MASK
+                       | LPUART_FIFO_RXFLUSH_MASK;
+
+            /* The end of a frame is taken from STAT[IDLE], set after the same idle time as RXIDEN */
+            ctrl_val &= ~(LPUART_CTRL_IDLECFG_MASK | LPUART_CTRL_ILIE_MASK);
+
+            if (HAL_UART_RX_IDLE_DISABLED != config->rxIdle)
+            {
+                ctrl_val |= LPUART_CTRL_IDLECFG((uint32_t)config->rxIdle - 1U) | LPUART_CTRL_ILIE_MASK;
+            }
+            else
+            {
+                /* Do nothing */
+            }
+
+            s_uartState[instance].fifoConfig = *config;
+            s_uartState[instance].fifoDepth = depth;
+
+            base->CTRL = ctrl_val;
+        }
+    }
+
+    return retVal;
+}
+
+void HAL_UART_DisableFifo(uint32_t instance)
+{
+    LPUART_Type * base = NULL;
+    uint32_t ctrl_val = 0U;
+
+    if (instance < HAL_UART_INSTANCE_COUNT)
+    {
+        base = s_uartMap[instance].base;
 
-        		if(g_rxBufferCount < g_rxBufferLength)
-        		{
-        			g_rxBuffer[g_rxBufferCount] = dataByte;
+        ctrl_val = base->CTRL;
+        base->CTRL = ctrl_val & ~(LPUART_CTRL_TE_MASK | LPUART_CTRL_RE_MASK);
+
+        base->FIFO = LPUART_FIFO_TXFLUSH_MASK | LPUART_FIFO_RXFLUSH_MASK;
+        base->WATER = 0U;
+        s_uartState[instance].fifoDepth = 0U;
+
+        base->CTRL = ctrl_val & ~(LPUART_CTRL_IDLECFG_MASK | LPUART_CTRL_ILIE_MASK);
+    }
+    else
+    {
+        /* Do nothing */
+    }
+}
 
-        			g_rxBufferCount++;
-        		}
-        		else
-        		{
-        			/* Do nothing */
-        		}
+uint8_t HAL_UART_GetBaudInfo(uint32_t instance, hal_uart_baud_info_t *info)
+{
+    uint8_t retVal = 1;
 
-        		if(g_rxBufferCount == g_rxBufferLength)
-        		{
-        			events |= ARM_USART_EVENT_RECEIVE_COMPLETE; /* (1UL << 1) */
+    if ((instance >= HAL_UART_INSTANCE_COUNT) || (NULL == info))
+    {
+        retVal = 0;
+    }
+    else
+    {
+        *info = s_uartState[instance].baudInfo;
+    }
 
-        			g_rxBuffer = NULL;
-        			g_rxBufferCount = 0;
-					g_rxBufferLength = 0;
+    return retVal;
+}
 
-					HAL_UART_DisableInterrupts(HAL_LPUART1, HAL_UART_INT_RX_DATA_REG_FULL);
+uint32_t HAL_UART_GetInterruptCount(uint32_t instance)
+{
+    uint32_t count = 0U;
 
-					events |= ARM_USART_EVENT_RECEIVE_COMPLETE;
-        		}
+    if (instance < HAL_UART_INSTANCE_COUNT)
+    {
+        count = s_uartState[instance].irqCount;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+
+    return count;
+}
+
+uint8_t HAL_UART_Send(uint32_t instance, const uint8_t *data, uint32_t length)
+{
+    uint8_t retVal = 1;
+
+    if ((instance >= HAL_UART_INSTANCE_COUNT) || (NULL == data) || (0U == length)
+        || (s_uartState[instance].txBusy != 0U))
+    {
+        retVal = 0;
+    }
+    else
+    {
+        s_uartState[instance].txBuffer = data;
+        s_uartState[instance].txLength = length;
+        s_uartState[instance].txCount = 0U;
+        s_uartState[instance].txDma = 0U;
+        s_uartState[instance].txBusy = 1U;
+
+        HAL_UART_EnableInterrupts(instance, HAL_UART_INT_TX_DATA_REG_EMPTY);
+    }
+
+    return retVal;
+}
+
+uint8_t HAL_UART_Receive(uint32_t instance, uint8_t *data, uint32_t length)
+{
+    uint8_t retVal = 1;
+
+    if ((instance >= HAL_UART_INSTANCE_COUNT) || (NULL == data) || (0U == length)
+        || (s_uartState[instance].rxBusy != 0U))
+    {
+        retVal = 0;
+    }
+    else
+    {
+        s_uartState[instance].rxBuffer = data;
+        s_uartState[instance].rxLength = length;
+        s_uartState[instance].rxCount = 0U;
+        s_uartState[instance].rxDma = 0U;
+        s_uartState[instance].rxBusy = 1U;
+
+        HAL_UART_EnableInterrupts(instance, HAL_UART_INT_RX_DATA_REG_FULL);
+    }
+
+    return retVal;
+}
+
+uint8_t HAL_UART_SendDma(uint32_t instance, const uint8_t *data, uint32_t length)
+{
+    uint8_t retVal = 1;
+    const uart_map_t * map = NULL;
+    hal_dma_transfer_t transfer;
+
+    if ((instance >= HAL_UART_INSTANCE_COUNT) || (NULL == data) || (0U == length)
+        || (length > 0x7FFFU) || (s_uartState[instance].txBusy != 0U))
+    {
+        retVal = 0;
+    }
+    else
+    {
+        map = &s_uartMap[instance];
+
+        /* Memory (incrementing) to DATA register (fixed), one byte per TDRE request */
+        transfer.srcAddr = (uint32_t)data;
+        transfer.srcOffset = 1;
+        transfer.srcLastAdjust = 0;
+        transfer.dstAddr = (uint32_t)&map->base->DATA;
+        transfer.dstOffset = 0;
+        transfer.dstLastAdjust = 0;
+        transfer.size = HAL_DMA_SIZE_8BIT;
+        transfer.count = (uint16_t)length;
+        transfer.halfInterrupt = 0U;
+        transfer.stopOnComplete = 1U;
+
+        if (HAL_DMA_ConfigureChannel(map->txDmaChannel, map->txDmaRequest, &transfer, HAL_UART_DmaCallback) == 0U)
+        {
+            retVal = 0;
+        }
+        else
+        {
+            s_uartState[instance].txBuffer = data;
+            s_uartState[instance].txLength = length;
+            s_uartState[instance].txCount = 0U;
+            s_uartState[instance].txDma = 1U;
+            s_uartState[instance].txBusy = 1U;
+
+            /* TDRE is routed to the DMA instead of the ISR */
+            HAL_UART_DisableInterrupts(instance, HAL_UART_INT_TX_DATA_REG_EMPTY);
+            map->base->BAUD |= LPUART_BAUD_TDMAE_MASK;
+            HAL_DMA_StartChannel(map->txDmaChannel);
+        }
+    }
+
+    return retVal;
+}
+
+uint8_t HAL_UART_ReceiveDma(uint32_t instance, uint8_t *data, uint32_t length)
+{
+    uint8_t retVal = 1;
+    const uart_map_t * map = NULL;
+    hal_dma_transfer_t transfer;
+
+    if ((instance >= HAL_UART_INSTANCE_COUNT) || (NULL == data) || (0U == length)
+        || (length > 0x7FFFU) || (s_uartState[instance].rxBusy != 0U))
+    {
+        retVal = 0;
+    }
+    else
+    {
+        map = &s_uartMap[instance];
+
+        /* DATA register (fixed) to memory (incrementing), one byte per RDRF request */
+        transfer.srcAddr = (uint32_t)&map->base->DATA;
+        transfer.srcOffset = 0;
+        transfer.srcLastAdjust = 0;
+        transfer.dstAddr = (uint32_t)data;
+        transfer.dstOffset = 1;
+        transfer.dstLastAdjust = 0;
+        transfer.size = HAL_DMA_SIZE_8BIT;
+        transfer.count = (uint16_t)length;
+        transfer.halfInterrupt = 0U;
+        transfer.stopOnComplete = 1U;
+
+        if (HAL_DMA_ConfigureChannel(map->rxDmaChannel, map->rxDmaRequest, &transfer, HAL_UART_DmaCallback) == 0U)
+        {
+            retVal = 0;
+        }
+        else
+        {
+            s_uartState[instance].rxBuffer = data;
+            s_uartState[instance].rxLength = length;
+            s_uartState[instance].rxCount = 0U;
+            s_uartState[instance].rxDma = 1U;
+            s_uartState[instance].rxBusy = 1U;
+
+            /* RDRF is routed to the DMA instead of the ISR */
+            HAL_UART_DisableInterrupts(instance, HAL_UART_INT_RX_DATA_REG_FULL);
+            map->base->BAUD |= LPUART_BAUD_RDMAE_MASK;
+            HAL_DMA_StartChannel(map->rxDmaChannel);
+        }
+    }
+
+    return retVal;
+}
+
+uint32_t HAL_UART_GetTxCount(uint32_t instance)
+{
+    uint32_t count = 0U;
+
+    if (instance < HAL_UART_INSTANCE_COUNT)
+    {
+        if ((s_uartState[instance].txBusy != 0U) && (s_uartState[instance].txDma != 0U))
+        {
+            /* Live progress read back from the DMA channel */
+            count = s_uartState[instance].txLength - HAL_DMA_GetRemainingCount(s_uartMap[instance].txDmaChannel);
+        }
+        else
+        {
+            count = s_uartState[instance].txCount;
+        }
+    }
+    else
+    {
+        /* Do nothing */
+    }
+
+    return count;
+}
+
+uint32_t HAL_UART_GetRxCount(uint32_t instance)
+{
+    uint32_t count = 0U;
+
+    if (instance < HAL_UART_INSTANCE_COUNT)
+    {
+        if ((s_uartState[instance].rxBusy != 0U) && (s_uartState[instance].rxDma != 0U))
+        {
+            /* Live progress read back from the DMA channel */
+            count = s_uartState[instance].rxLength - HAL_DMA_GetRemainingCount(s_uartMap[instance].rxDmaChannel);
+        }
+        else
+        {
+            count = s_uartState[instance].rxCount;
+        }
+    }
+    else
+    {
+        /* Do nothing */
+    }
+
+    return count;
+}
+
+uint8_t HAL_UART_IsTxBusy(uint32_t instance)
+{
+    uint8_t busy = 0U;
+
+    if (instance < HAL_UART_INSTANCE_COUNT)
+    {
+        busy = s_uartState[instance].txBusy;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+
+    return busy;
+}
+
+uint8_t HAL_UART_IsRxBusy(uint32_t instance)
+{
+    uint8_t busy = 0U;
+
+    if (instance < HAL_UART_INSTANCE_COUNT)
+    {
+        busy = s_uartState[instance].rxBusy;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+
+    return busy;
+}
+
+/**
+ * @brief Writes pending TX data until the FIFO is full or no data is left.
+ * Called from the IRQ handler when TDRE is set (TXCOUNT <= TX watermark).
+ *
+ * @param instance The virtual UART instance.
+ * @return Bitmask of CMSIS USART events produced.
+ */
+static uint32_t HAL_UART_FillTx(uint32_t instance)
+{
+    LPUART_Type * base = s_uartMap[instance].base;
+    uart_state_t * state = &s_uartState[instance];
+    uint32_t events = 0U;
+    uint32_t room = 1U;
+    uint8_t txByte = 0U;
+    uint8_t done = 0U;
+
+    if (s_uartState[instance].fifoDepth != 0U)
+    {
+        room = s_uartState[instance].fifoDepth - ((base->WATER & LPUART_WATER_TXCOUNT_MASK) >> LPUART_WATER_TXCOUNT_SHIFT);
+    }
+    else
+    {
+        /* Do nothing */
+    }
+
+    while ((room > 0U) && (0U == done))
+    {
+        if ((state->txBusy != 0U) && (0U == state->txDma))
+        {
+            /* Block mode: send the application buffer first */
+            if (state->txCount < state->txLength)
+            {
+                base->DATA = (uint32_t)state->txBuffer[state->txCount];
+                state->txCount++;
+                room--;
+            }
+            else
+            {
+                /* Release the buffer, queued ring data (if any) follows */
+                state->txBuffer = NULL;
+                state->txBusy = 0U;
+                events |= ARM_USART_EVENT_SEND_COMPLETE;
+            }
+        }
+        else if (RingBuffer_Get(&state->txRing, &txByte) != 0U)
+        {
+            /* Buffered mode: drain the TX ring buffer */
+            base->DATA = (uint32_t)txByte;
+            room--;
+        }
+        else
+        {
+            HAL_UART_DisableInterrupts(instance, HAL_UART_INT_TX_DATA_REG_EMPTY);
+            done = 1U;
+        }
+    }
+
+    return events;
+}
+
+/**
+ * @brief Reads every byte currently held in the RX FIFO.
+ * Called from the IRQ handler when RDRF is set, either because RXCOUNT is
+ * above the RX watermark or because the line went idle (RXIDEN), and when
+ * STAT[IDLE] closes a frame.
+ *
+ * @param instance The virtual UART instance.
+ * @return Bitmask of CMSIS USART events produced.
+ */
+static uint32_t HAL_UART_DrainRx(uint32_t instance)
+{
+    LPUART_Type * base = s_uartMap[instance].base;
+    uart_state_t * state = &s_uartState[instance];
+    uint32_t events = 0U;
+    uint32_t count = 1U;
+    uint8_t dataByte = 0U;
+
+    if (state->fifoDepth != 0U)
+    {
+        count = (base->WATER & LPUART_WATER_RXCOUNT_MASK) >> LPUART_WATER_RXCOUNT_SHIFT;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+
+    while (count > 0U)
+    {
+        dataByte = (uint8_t)base->DATA;
+        count--;
+
+        if ((state->rxBusy != 0U) && (0U == state->rxDma))
+        {
+            state->rxBuffer[state->rxCount] = dataByte;
+            state->rxCount++;
+
+            if (state->rxCount == state->rxLength)
+            {
+                state->rxBuffer = NULL;
+                state->rxBusy = 0U;
+
+                /* Keep RX interrupt for buffered mode or the byte handler, if running */
+                if ((0U == state->rxBuffered) && (NULL == state->rxHandler))
+                {
+                    HAL_UART_DisableInterrupts(instance, HAL_UART_INT_RX_DATA_REG_FULL);
+                }
+                else
+                {
+                    /* Do nothing */
+                }
+
+                events |= ARM_USART_EVENT_RECEIVE_COMPLETE;
+            }
+            else
+            {
+                /* Do nothing */
+            }
+        }
+        else if (state->rxHandler != NULL)
+        {
+            /* Byte handler: the application consumes the byte in the ISR */
+            state->rxHandler(dataByte);
+        }
+        else if (state->rxBuffered != 0U)
+        {
+            /* Buffered mode: only copy the byte, the application drains in batches */
+            if (RingBuffer_Put(&state->rxRing, dataByte) == 0U)
+            {
+                events |= ARM_USART_EVENT_RX_OVERFLOW;
+            }
+            else
+            {
+                /* Do nothing */
+            }
+        }
+        else
+        {
+            /* Nobody is waiting for data, the byte is dropped */
+        }
+    }
+
+    return events;
+}
+
+/**
+ * @brief DMA channel callback shared by every UART instance.
+ * Finds the instance owning the channel, stops the DMA requests of the LPUART
+ * and reports the completion, or the transfer error, to the registered UART callback.
+ */
+static void HAL_UART_DmaCallback(uint32_t channel, uint32_t event)
+{
+    uint32_t instance = 0U;
+    uint32_t events = 0U;
+    LPUART_Type * base = NULL;
+
+    for (instance = 0U; instance < HAL_UART_INSTANCE_COUNT; instance++)
+    {
+        base = s_uartMap[instance].base;
+
+        if ((channel == s_uartMap[instance].txDmaChannel) && (s_uartState[instance].txBusy != 0U)
+            && (s_uartState[instance].txDma != 0U))
+        {
+            base->BAUD &= ~LPUART_BAUD_TDMAE_MASK;
+            s_uartState[instance].txCount = s_uartState[instance].txLength - HAL_DMA_GetRemainingCount(channel);
+            s_uartState[instance].txBusy = 0U;
+
+            if ((event & HAL_DMA_EVENT_MAJOR_COMPLETE) != 0U)
+            {
+                events |= ARM_USART_EVENT_SEND_COMPLETE;
+            }
+            else if ((event & HAL_DMA_EVENT_ERROR) != 0U)
+            {
+                /* The owner of the buffer must be told, txCount holds the bytes moved */
+                events |= HAL_UART_EVENT_TX_DMA_ERROR;
+            }
+            else
+            {
+                /* Do nothing */
+            }
+        }
+        else if ((channel == s_uartMap[instance].rxDmaChannel) && (s_uartState[instance].rxBusy != 0U)
+            && (s_uartState[instance].rxDma != 0U))
+        {
+            base->BAUD &= ~LPUART_BAUD_RDMAE_MASK;
+            s_uartState[instance].rxCount = s_uartState[instance].rxLength - HAL_DMA_GetRemainingCount(channel);
+            s_uartState[instance].rxBusy = 0U;
+
+            if ((event & HAL_DMA_EVENT_MAJOR_COMPLETE) != 0U)
+            {
+                events |= ARM_USART_EVENT_RECEIVE_COMPLETE;
+            }
+            else if ((event & HAL_DMA_EVENT_ERROR) != 0U)
+            {
+                events |= HAL_UART_EVENT_RX_DMA_ERROR;
+            }
+            else
+            {
+                /* Do nothing */
+            }
+        }
+        else
+        {
+            /* Do nothing */
+        }
+
+        /* Publish event to application */
+        if ((events != 0U) && (s_uartState[instance].callback != NULL))
+        {
+            s_uartState[instance].callback(events);
+            events = 0U;
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }
+}
+
+/**
+ * @brief Clears write-1-to-clear STAT flags without touching the other ones.
+ *
+ * @param base LPUART peripheral base pointer.
+ * @param flags STAT flags to clear, from HAL_UART_STAT_W1C_MASK.
+ */
+static void HAL_UART_ClearStatusFlags(LPUART_Type * base, uint32_t flags)
+{
+    base->STAT = (base->STAT & ~HAL_UART_STAT_W1C_MASK) | (flags & HAL_UART_STAT_W1C_MASK);
+}
+
+/**
+ * @brief Common IRQ Handler for LPUART instances.
+ * This function should be called from the specific IRQ handlers.
+ */
+static void HAL_UART_IRQHandler(uint32_t instance)
+{
+    LPUART_Type* base = s_uartMap[instance].base;
+    uint32_t stat = 0U;
+    uint32_t events = 0U;
+
+
+    if (instance < HAL_UART_INSTANCE_COUNT)
+    {
+    	s_uartState[instance].irqCount++;
+    	stat = base->STAT;
+
+        /* Check transmit data register empty, fill up to the FIFO depth */
+        if(((stat & LPUART_STAT_TDRE_MASK) != 0U) && ((base->CTRL & LPUART_CTRL_TIE_MASK) != 0U))
+        {
+        	events |= HAL_UART_FillTx(instance);
+        }
+        else
+        {
+        	/* Do nothing */
+        }
+
+        /* Check receive data register full, drain the whole FIFO */
+        if (((stat & LPUART_STAT_RDRF_MASK) != 0U) && ((base->CTRL & LPUART_CTRL_RIE_MASK) != 0U))
+        {
+        	events |= HAL_UART_DrainRx(instance);
+        }
+        else
+        {
+            /* Do nothing */
+        }
+
+        /* Check idle line: the frame has ended, whatever RXCOUNT was when its last byte arrived */
+        if (((stat & LPUART_STAT_IDLE_MASK) != 0U) && ((base->CTRL & LPUART_CTRL_ILIE_MASK) != 0U))
+        {
+            HAL_UART_ClearStatusFlags(base, LPUART_STAT_IDLE_MASK);
+
+            /* Words left under the watermark are read before the frame is reported closed */
+            if ((base->CTRL & LPUART_CTRL_RIE_MASK) != 0U)
+            {
+                events |= HAL_UART_DrainRx(instance);
+            }
+            else
+            {
+                /* Do nothing */
+            }
 
-        	}
-        	else
-        	{
-        		/* Do nothing */
-        	}
+            events |= ARM_USART_EVENT_RX_TIMEOUT;
         }
         else
         {
@@ -541,7 +1448,7 @@ static void HAL_UART_IRQHandler(uint32_t instance)
         {
             events |= ARM_USART_EVENT_RX_OVERFLOW; /* (1UL << 5) */
             /* Clear Overrun flag */
-            s_uartMap[instance].base->STAT |= LPUART_STAT_OR_MASK;
+            HAL_UART_ClearStatusFlags(base, LPUART_STAT_OR_MASK);
         }
         else
         {
@@ -549,9 +1456,9 @@ static void HAL_UART_IRQHandler(uint32_t instance)
         }
 
         /* Publish event to application */
-        if ((events != 0U) && (s_uartCallbacks[instance] != NULL))
+        if ((events != 0U) && (s_uartState[instance].callback != NULL))
         {
-            s_uartCallbacks[instance](events);
+            s_uartState[instance].callback(events);
         }
         else
         {
@@ -4,9 +4,15 @@
  * @brief A library contain function that configure the LPUART peripheral register for initializing the
  * peripheral, using the peripheral and processing data of that peripheral at hardware level.
  * Current version of this library support:
- * - Basic config function for LPUART0, LPUART1 and LPUART2.
- * - Basic function to processing data, including: send and receive blocking.
+ * - Basic config function for LPUART0, LPUART1 and LPUART2, each instance has its own transfer state
+ *   so the three ports can run concurrent transfers.
+ * - Basic function to processing data, including: send and receive blocking, with a timeout in microseconds.
  * - Support configure interrupt, including: overun detect, full receiver data register detect, full and empty transmitter data register detect.
+ * - Byte handler mode: every received byte is handed to an application hook in the ISR.
+ * - Buffered mode: per-instance lock-free RX/TX ring buffers filled and drained by the ISR, with bulk read/write API.
+ * - FIFO mode: hardware TX/RX FIFOs with watermarks and RX idle flush, the ISR moves up to FIFO depth bytes per interrupt.
+ * - Baud rate solver: OSR 4..32 and SBR searched from the real functional clock, BOTHEDGE for low OSR.
+ * - DMA mode: whole buffer send and receive moved by eDMA, progress read back from the DMA channel.
  * @version 0.1
  * @date 2025-10-08
  * 
@@ -22,6 +28,7 @@
  ******************************************************************************/
 #include "S32K144.h"
 #include "stddef.h"
+#include "ring_buffer.h"
 
 /*******************************************************************************
  * Definitions
@@ -35,6 +42,18 @@
 #define HAL_LPUART1             1U
 #define HAL_LPUART2             2U
 
+/**
+ * @brief Size of the per-instance ring buffers used in buffered mode.
+ * Must be a power of two.
+ */
+#define HAL_UART_RX_RING_SIZE   128U
+#define HAL_UART_TX_RING_SIZE   128U
+
+/**
+ * @brief Maximum baud rate error accepted by HAL_UART_Configure, in 0.01 % units (3 %).
+ */
+#define HAL_UART_BAUD_TOLERANCE 300U
+
 /* Dummy define for testing the hal layer */
 #define ARM_USART_EVENT_SEND_COMPLETE       (1UL << 0)  ///< Send completed; however USART may still transmit data
 #define ARM_USART_EVENT_RECEIVE_COMPLETE    (1UL << 1)  ///< Receive completed
@@ -51,6 +70,10 @@
 #define ARM_USART_EVENT_DCD                 (1UL << 12) ///< DCD state changed (optional)
 #define ARM_USART_EVENT_RI                  (1UL << 13) ///< RI  state changed (optional)
 
+/* Driver specific events, above the CMSIS range */
+#define HAL_UART_EVENT_TX_DMA_ERROR         (1UL << 16) ///< eDMA send stopped on a transfer error
+#define HAL_UART_EVENT_RX_DMA_ERROR         (1UL << 17) ///< eDMA receive stopped on a transfer error
+
 
 /**
  * @brief Defines HAL-specific data bit configurations.
@@ -92,6 +115,32 @@ typedef enum
     HAL_UART_INT_RX_OVERRUN        = (1U << 3U)  /* Corresponds to STAT[OR]   */
 } hal_uart_interrupt_t;
 
+/**
+ * @brief Defines the number of idle characters after which a partially filled
+ * RX FIFO raises RDRF (FIFO[RXIDEN]) and the frame is closed (CTRL[IDLECFG]).
+ */
+typedef enum
+{
+    HAL_UART_RX_IDLE_DISABLED = 0U,
+    HAL_UART_RX_IDLE_1_CHAR   = 1U,
+    HAL_UART_RX_IDLE_2_CHARS  = 2U,
+    HAL_UART_RX_IDLE_4_CHARS  = 3U,
+    HAL_UART_RX_IDLE_8_CHARS  = 4U,
+    HAL_UART_RX_IDLE_16_CHARS = 5U,
+    HAL_UART_RX_IDLE_32_CHARS = 6U,
+    HAL_UART_RX_IDLE_64_CHARS = 7U
+} hal_uart_rx_idle_t;
+
+/**
+ * @brief Structure for UART FIFO configuration parameters.
+ */
+typedef struct
+{
+    uint8_t txWatermark;            /* TDRE is set while TXCOUNT <= txWatermark */
+    uint8_t rxWatermark;            /* RDRF is set while RXCOUNT > rxWatermark */
+    hal_uart_rx_idle_t rxIdle;      /* Flush a partial RX FIFO after this idle time */
+} hal_uart_fifo_config_t;
+
 /**
  * @brief Structure for UART configuration parameters.
  */
@@ -103,19 +152,27 @@ typedef struct
     hal_uart_stopbits_t stopBits;
 } hal_uart_config_t;
 
+/**
+ * @brief Structure reporting the baud rate actually programmed.
+ */
+typedef struct
+{
+    uint32_t osr;                   /* Oversampling ratio, 4..32 */
+    uint32_t sbr;                   /* Baud rate modulo divisor, 1..8191 */
+    uint32_t actualBaud;            /* Achieved baud rate */
+    uint32_t errorX100;             /* Error against the requested baud rate, in 0.01 % */
+} hal_uart_baud_info_t;
+
 /**
  * @brief Defines the callback function pointer type for UART events.
  * The 'event' parameter will be a bitmask of CMSIS USART events.
  */
 typedef void (*HAL_UART_Callback_t)(uint32_t event);
 
-extern volatile uint8_t* g_txBuffer;
-extern volatile uint32_t g_txBufferLength;
-extern volatile uint32_t g_txBufferCount;
-
-extern volatile uint8_t* g_rxBuffer;
-extern volatile uint32_t g_rxBufferCount;
-extern volatile uint32_t g_rxBufferLength;
+/**
+ * @brief Defines the per-byte receive hook, called from the ISR for every byte received.
+ */
+typedef void (*HAL_UART_RxHandler_t)(uint8_t data);
 
 /*******************************************************************************
  * API
@@ -124,18 +181,23 @@ extern volatile uint32_t g_rxBufferLength;
 /**
  * @brief Initializes a LPUART instance.
  * Enables clocks for LPUART and PORT modules, and configures pins.
+ * The system time base (time_init) must already run, the timeout functions rely on it.
+ * HAL_DMA_Init must be called by the application before the DMA transfer mode is used.
  *
  * @param instance The virtual UART instance (e.g., HAL_LPUART0).
- * @return true if initialization is successful, false otherwise.
+ * @return true if initialization is successful, false if the instance is invalid
+ * or the time base is not running.
  */
 uint8_t HAL_UART_Init(uint32_t instance);
 
 /**
  * @brief Configures a LPUART instance with specified parameters.
+ * The baud rate divisors are solved from the functional clock read back from PCC/SCG,
+ * use HAL_UART_GetBaudInfo to get the achieved baud rate and error.
  *
  * @param instance The virtual UART instance.
  * @param config Pointer to the configuration structure.
- * @return true if configuration is successful, false otherwise.
+ * @return true if configuration is successful, false otherwise (e.g. baud error above HAL_UART_BAUD_TOLERANCE).
  */
 uint8_t HAL_UART_Configure(uint32_t instance, const hal_uart_config_t *config);
 
@@ -173,6 +235,26 @@ void HAL_UART_SendByteBlocking(uint32_t instance, uint8_t data);
  */
 uint8_t HAL_UART_ReadByteBlocking(uint32_t instance);
 
+/**
+ * @brief Sends a single byte of data, waiting at most a given time for the transmit buffer.
+ *
+ * @param instance The virtual UART instance.
+ * @param data The byte of data to send.
+ * @param timeoutUs Maximum wait in microseconds, measured on the system time base.
+ * @return 1 if the byte was written, 0 on timeout, invalid instance or time base not running.
+ */
+uint8_t HAL_UART_SendByteTimeout(uint32_t instance, uint8_t data, uint32_t timeoutUs);
+
+/**
+ * @brief Reads a single byte of data, waiting at most a given time for it.
+ *
+ * @param instance The virtual UART instance.
+ * @param data Pointer where the received byte is stored.
+ * @param timeoutUs Maximum wait in microseconds, measured on the system time base.
+ * @return 1 if a byte was read, 0 on timeout, invalid parameter or time base not running.
+ */
+uint8_t HAL_UART_ReadByteTimeout(uint32_t instance, uint8_t *data, uint32_t timeoutUs);
+
 /**
  * @brief Enables one or more UART interrupts.
  *
@@ -213,4 +295,193 @@ void HAL_UART_EnableReceiver(uint32_t instance, uint8_t enable);
  */
 uint32_t HAL_UART_GetStatusFlags(uint32_t instance);
 
+/**
+ * @brief Starts buffered reception on a UART instance.
+ * Every received byte is copied by the ISR into the instance RX ring buffer,
+ * no callback is raised per byte. Bytes are dropped when the ring is full and
+ * ARM_USART_EVENT_RX_OVERFLOW is reported to the registered callback.
+ *
+ * @param instance The virtual UART instance.
+ * @return 1 if buffered reception is started, 0 otherwise.
+ */
+uint8_t HAL_UART_StartBufferedReceive(uint32_t instance);
+
+/**
+ * @brief Stops buffered reception on a UART instance.
+ * Bytes already stored in the RX ring buffer can still be read.
+ *
+ * @param instance The virtual UART instance.
+ */
+void HAL_UART_StopBufferedReceive(uint32_t instance);
+
+/**
+ * @brief Starts handing every received byte to a hook, called from the ISR.
+ * Takes precedence over buffered mode. Registered callback events (e.g.
+ * ARM_USART_EVENT_RX_TIMEOUT on idle line) are raised after the bytes of the
+ * same interrupt have been handed out.
+ *
+ * @param instance The virtual UART instance.
+ * @param handler The byte hook, must be short since it runs in interrupt context.
+ * @return 1 if started, 0 otherwise.
+ */
+uint8_t HAL_UART_StartRxHandler(uint32_t instance, HAL_UART_RxHandler_t handler);
+
+/**
+ * @brief Stops handing received bytes to the hook.
+ *
+ * @param instance The virtual UART instance.
+ */
+void HAL_UART_StopRxHandler(uint32_t instance);
+
+/**
+ * @brief Reads received bytes from the instance RX ring buffer.
+ * This is a non-blocking function, safe to call from the main loop while the
+ * ISR is receiving.
+ *
+ * @param instance The virtual UART instance.
+ * @param data Pointer to the destination buffer.
+ * @param maxLength Maximum number of bytes to read.
+ * @return Number of bytes actually read.
+ */
+uint32_t HAL_UART_ReadBuffered(uint32_t instance, uint8_t *data, uint32_t maxLength);
+
+/**
+ * @brief Writes bytes into the instance TX ring buffer and starts transmission.
+ * This is a non-blocking function, the ISR drains the ring buffer.
+ *
+ * @param instance The virtual UART instance.
+ * @param data Pointer to the data to send.
+ * @param length Number of bytes to send.
+ * @return Number of bytes actually queued, less than length if the ring is full.
+ */
+uint32_t HAL_UART_WriteBuffered(uint32_t instance, const uint8_t *data, uint32_t length);
+
+/**
+ * @brief Gets the number of bytes waiting in the instance RX ring buffer.
+ *
+ * @param instance The virtual UART instance.
+ * @return Number of bytes available for reading.
+ */
+uint32_t HAL_UART_GetRxBufferedCount(uint32_t instance);
+
+/**
+ * @brief Enables the TX/RX FIFOs of a UART instance.
+ * Both FIFOs are flushed. The transmitter and receiver are disabled during the
+ * update and restored afterwards. With an RX idle time, the idle line interrupt
+ * (STAT[IDLE]) is enabled: once the line stays idle after a frame, the bytes left in
+ * the FIFO are read and ARM_USART_EVENT_RX_TIMEOUT is reported to the registered
+ * callback, also when the last bytes of the frame pushed RXCOUNT above the watermark.
+ *
+ * @param instance The virtual UART instance.
+ * @param config Pointer to the FIFO configuration structure.
+ * @return 1 if configuration is successful, 0 otherwise (e.g. watermark not below FIFO depth).
+ */
+uint8_t HAL_UART_ConfigureFifo(uint32_t instance, const hal_uart_fifo_config_t *config);
+
+/**
+ * @brief Disables the TX/RX FIFOs of a UART instance, one byte is moved per interrupt.
+ *
+ * @param instance The virtual UART instance.
+ */
+void HAL_UART_DisableFifo(uint32_t instance);
+
+/**
+ * @brief Gets the result of the last baud rate solve of a UART instance.
+ *
+ * @param instance The virtual UART instance.
+ * @param info Pointer to store the selected OSR/SBR, the achieved baud rate and the error.
+ * @return 1 if successful, 0 otherwise.
+ */
+uint8_t HAL_UART_GetBaudInfo(uint32_t instance, hal_uart_baud_info_t *info);
+
+/**
+ * @brief Gets the number of interrupts served by a UART instance since reset.
+ * Useful to measure the interrupt load of a transfer.
+ *
+ * @param instance The virtual UART instance.
+ * @return Number of interrupts served.
+ */
+uint32_t HAL_UART_GetInterruptCount(uint32_t instance);
+
+/**
+ * @brief Sends a buffer using the TX interrupt (non-blocking).
+ * ARM_USART_EVENT_SEND_COMPLETE is reported to the registered callback when done.
+ * The buffer must stay valid until the transfer completes.
+ *
+ * @param instance The virtual UART instance.
+ * @param data Pointer to the data to send.
+ * @param length Number of bytes to send.
+ * @return 1 if the transfer is started, 0 otherwise (e.g. a send is already running).
+ */
+uint8_t HAL_UART_Send(uint32_t instance, const uint8_t *data, uint32_t length);
+
+/**
+ * @brief Receives into a buffer using the RX interrupt (non-blocking).
+ * ARM_USART_EVENT_RECEIVE_COMPLETE is reported to the registered callback when done.
+ *
+ * @param instance The virtual UART instance.
+ * @param data Pointer to the destination buffer.
+ * @param length Number of bytes to receive.
+ * @return 1 if the transfer is started, 0 otherwise (e.g. a receive is already running).
+ */
+uint8_t HAL_UART_Receive(uint32_t instance, uint8_t *data, uint32_t length);
+
+/**
+ * @brief Sends a buffer using eDMA, the CPU is not involved until the last byte is moved.
+ * ARM_USART_EVENT_SEND_COMPLETE is reported to the registered callback when done,
+ * HAL_UART_EVENT_TX_DMA_ERROR if the channel stops on a transfer error.
+ * The buffer must stay valid until the transfer completes.
+ *
+ * @param instance The virtual UART instance.
+ * @param data Pointer to the data to send.
+ * @param length Number of bytes to send, 1..32767.
+ * @return 1 if the transfer is started, 0 otherwise (e.g. a send is already running).
+ */
+uint8_t HAL_UART_SendDma(uint32_t instance, const uint8_t *data, uint32_t length);
+
+/**
+ * @brief Receives into a buffer using eDMA, the RX interrupt is disabled meanwhile.
+ * ARM_USART_EVENT_RECEIVE_COMPLETE is reported to the registered callback when done,
+ * HAL_UART_EVENT_RX_DMA_ERROR if the channel stops on a transfer error.
+ * With the RX FIFO enabled, a request is raised only above the RX watermark or on idle.
+ *
+ * @param instance The virtual UART instance.
+ * @param data Pointer to the destination buffer.
+ * @param length Number of bytes to receive, 1..32767.
+ * @return 1 if the transfer is started, 0 otherwise (e.g. a receive is already running).
+ */
+uint8_t HAL_UART_ReceiveDma(uint32_t instance, uint8_t *data, uint32_t length);
+
+/**
+ * @brief Gets the number of bytes sent by the running (or last) send.
+ *
+ * @param instance The virtual UART instance.
+ * @return Number of bytes moved.
+ */
+uint32_t HAL_UART_GetTxCount(uint32_t instance);
+
+/**
+ * @brief Gets the number of bytes received by the running (or last) receive.
+ *
+ * @param instance The virtual UART instance.
+ * @return Number of bytes moved.
+ */
+uint32_t HAL_UART_GetRxCount(uint32_t instance);
+
+/**
+ * @brief Checks whether a send (interrupt or DMA) is running.
+ *
+ * @param instance The virtual UART instance.
+ * @return 1 if busy, 0 otherwise.
+ */
+uint8_t HAL_UART_IsTxBusy(uint32_t instance);
+
+/**
+ * @brief Checks whether a receive (interrupt or DMA) is running.
+ *
+ * @param instance The virtual UART instance.
+ * @return 1 if busy, 0 otherwise.
+ */
+uint8_t HAL_UART_IsRxBusy(uint32_t instance);
+
 #endif /* HAL_UART_H_ */
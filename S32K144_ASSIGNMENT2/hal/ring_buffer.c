@@ -0,0 +1,180 @@
+/**
+ * @file ring_buffer.c
+ * @author benecosta2711
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include "ring_buffer.h"
+#include <string.h>
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/**
+ * @brief Compiler barrier.
+ * Keeps the data copy ordered before the index update that publishes it, the
+ * storage itself is not volatile so memcpy can be used on it.
+ */
+#define RING_BUFFER_BARRIER()   __asm volatile ("" : : : "memory")
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+uint8_t RingBuffer_Init(ring_buffer_t *rb, uint8_t *storage, uint32_t size)
+{
+    uint8_t retVal = 1;
+
+    /* Size must be a non-zero power of two so the index can be masked */
+    if ((NULL == rb) || (NULL == storage) || (0U == size) || ((size & (size - 1U)) != 0U))
+    {
+        retVal = 0;
+    }
+    else
+    {
+        rb->buffer = storage;
+        rb->mask = size - 1U;
+        rb->head = 0U;
+        rb->tail = 0U;
+    }
+
+    return retVal;
+}
+
+void RingBuffer_Reset(ring_buffer_t *rb)
+{
+    rb->head = 0U;
+    rb->tail = 0U;
+}
+
+uint32_t RingBuffer_GetCount(const ring_buffer_t *rb)
+{
+    /* Unsigned subtraction stays correct when the indexes wrap around */
+    return rb->head - rb->tail;
+}
+
+uint32_t RingBuffer_GetFree(const ring_buffer_t *rb)
+{
+    return (rb->mask + 1U) - (rb->head - rb->tail);
+}
+
+uint8_t RingBuffer_Put(ring_buffer_t *rb, uint8_t data)
+{
+    uint8_t retVal = 0;
+    uint32_t head = rb->head;
+
+    if ((head - rb->tail) <= rb->mask)
+    {
+        rb->buffer[head & rb->mask] = data;
+
+        /* Publish the byte only after it is stored */
+        RING_BUFFER_BARRIER();
+        rb->head = head + 1U;
+        retVal = 1;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+
+    return retVal;
+}
+
+uint8_t RingBuffer_Get(ring_buffer_t *rb, uint8_t *data)
+{
+    uint8_t retVal = 0;
+    uint32_t tail = rb->tail;
+
+    if (rb->head != tail)
+    {
+        *data = rb->buffer[tail & rb->mask];
+
+        /* Release the slot only after it is read */
+        RING_BUFFER_BARRIER();
+        rb->tail = tail + 1U;
+        retVal = 1;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+
+    return retVal;
+}
+
+uint32_t RingBuffer_Write(ring_buffer_t *rb, const uint8_t *data, uint32_t length)
+{
+    uint32_t head = rb->head;
+    uint32_t space = (rb->mask + 1U) - (head - rb->tail);
+    uint32_t offset = head & rb->mask;
+    uint32_t firstChunk = 0U;
+
+    if (length > space)
+    {
+        length = space;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+
+    /* Copy up to the end of the storage, then wrap to the beginning */
+    firstChunk = (rb->mask + 1U) - offset;
+    if (firstChunk > length)
+    {
+        firstChunk = length;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+
+    memcpy(&rb->buffer[offset], data, firstChunk);
+    memcpy(&rb->buffer[0], &data[firstChunk], length - firstChunk);
+
+    RING_BUFFER_BARRIER();
+    rb->head = head + length;
+
+    return length;
+}
+
+uint32_t RingBuffer_Read(ring_buffer_t *rb, uint8_t *data, uint32_t length)
+{
+    uint32_t tail = rb->tail;
+    uint32_t count = rb->head - tail;
+    uint32_t offset = tail & rb->mask;
+    uint32_t firstChunk = 0U;
+
+    if (length > count)
+    {
+        length = count;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+
+    /* Copy up to the end of the storage, then wrap to the beginning */
+    firstChunk = (rb->mask + 1U) - offset;
+    if (firstChunk > length)
+    {
+        firstChunk = length;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+
+    memcpy(data, &rb->buffer[offset], firstChunk);
+    memcpy(&data[firstChunk], &rb->buffer[0], length - firstChunk);
+
+    RING_BUFFER_BARRIER();
+    rb->tail = tail + length;
+
+    return length;
+}
@@ -0,0 +1,118 @@
+/**
+ * @file ring_buffer.h
+ * @author benecosta2711
+ * @brief A lock-free single-producer/single-consumer byte ring buffer.
+ * Current version of this library support:
+ * - Power-of-two sized storage, indexes are free running and masked on access.
+ * - One producer and one consumer may run concurrently (e.g. ISR and main loop)
+ *   without masking interrupts, because each index is written by one side only.
+ * - Single byte and bulk put/get functions.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#ifndef RING_BUFFER_H_
+#define RING_BUFFER_H_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <stdint.h>
+#include "stddef.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/**
+ * @brief Ring buffer control structure.
+ * 'head' is only written by the producer, 'tail' is only written by the consumer.
+ */
+typedef struct
+{
+    uint8_t *               buffer;     /* Storage, size must be a power of two */
+    uint32_t                mask;       /* Storage size - 1 */
+    volatile uint32_t       head;       /* Free running write index */
+    volatile uint32_t       tail;       /* Free running read index */
+} ring_buffer_t;
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+/**
+ * @brief Initializes a ring buffer on top of caller-supplied storage.
+ *
+ * @param rb Pointer to the ring buffer control structure.
+ * @param storage Pointer to the storage array.
+ * @param size Size of the storage in bytes, must be a power of two.
+ * @return 1 if initialization is successful, 0 otherwise.
+ */
+uint8_t RingBuffer_Init(ring_buffer_t *rb, uint8_t *storage, uint32_t size);
+
+/**
+ * @brief Drops all data in the ring buffer.
+ * Must only be called when neither producer nor consumer is active.
+ *
+ * @param rb Pointer to the ring buffer control structure.
+ */
+void RingBuffer_Reset(ring_buffer_t *rb);
+
+/**
+ * @brief Gets the number of bytes stored in the ring buffer.
+ *
+ * @param rb Pointer to the ring buffer control structure.
+ * @return Number of bytes available for reading.
+ */
+uint32_t RingBuffer_GetCount(const ring_buffer_t *rb);
+
+/**
+ * @brief Gets the number of free bytes in the ring buffer.
+ *
+ * @param rb Pointer to the ring buffer control structure.
+ * @return Number of bytes available for writing.
+ */
+uint32_t RingBuffer_GetFree(const ring_buffer_t *rb);
+
+/**
+ * @brief Puts a single byte into the ring buffer (producer side).
+ *
+ * @param rb Pointer to the ring buffer control structure.
+ * @param data The byte to store.
+ * @return 1 if the byte is stored, 0 if the ring buffer is full.
+ */
+uint8_t RingBuffer_Put(ring_buffer_t *rb, uint8_t data);
+
+/**
+ * @brief Gets a single byte from the ring buffer (consumer side).
+ *
+ * @param rb Pointer to the ring buffer control structure.
+ * @param data Pointer to store the byte read.
+ * @return 1 if a byte is read, 0 if the ring buffer is empty.
+ */
+uint8_t RingBuffer_Get(ring_buffer_t *rb, uint8_t *data);
+
+/**
+ * @brief Writes up to 'length' bytes into the ring buffer (producer side).
+ *
+ * @param rb Pointer to the ring buffer control structure.
+ * @param data Pointer to the data to write.
+ * @param length Number of bytes to write.
+ * @return Number of bytes actually written.
+ */
+uint32_t RingBuffer_Write(ring_buffer_t *rb, const uint8_t *data, uint32_t length);
+
+/**
+ * @brief Reads up to 'length' bytes from the ring buffer (consumer side).
+ *
+ * @param rb Pointer to the ring buffer control structure.
+ * @param data Pointer to the destination buffer.
+ * @param length Maximum number of bytes to read.
+ * @return Number of bytes actually read.
+ */
+uint32_t RingBuffer_Read(ring_buffer_t *rb, uint8_t *data, uint32_t length);
+
+#endif /* RING_BUFFER_H_ */
@@ -77,18 +77,11 @@ static void TIM_ClearInterruptFlag(uint8_t channel)
  */
 void TIM_Init(void)
 {
-    /* 1. Cấp clock cho LPIT */
-    IP_PCC->PCCn[PCC_LPIT_INDEX] &= ~PCC_PCCn_CGC_MASK;
-    /* chọn nguồn SPLLDIV2_CLK */
-    IP_PCC->PCCn[PCC_LPIT_INDEX] |= PCC_PCCn_PCS(6);
-    IP_PCC->PCCn[PCC_LPIT_INDEX] |= PCC_PCCn_CGC_MASK;
-
-    /* 2. Reset ngoại vi bằng phần mềm */
-    IP_LPIT0->MCR |= LPIT_MCR_SW_RST_MASK;
-    IP_LPIT0->MCR &= ~LPIT_MCR_SW_RST_MASK;
-
-    /* 3. Bật module LPIT */
-    IP_LPIT0->MCR |= LPIT_MCR_M_CEN_MASK;
+    /*
+     * 1-3. Cấp clock và bật module LPIT qua time base. Không reset LPIT bằng phần mềm
+     * vì kênh 2 và 3 đang làm bộ đếm thời gian của hệ thống.
+     */
+    (void)time_init();
 
     /* 4. Cấu hình kênh 0 của LPIT */
     IP_LPIT0->TMR[0].TCTRL = 0;
@@ -101,7 +94,7 @@ void TIM_Init(void)
     IP_LPIT0->MCR |= LPIT_MCR_DBG_EN_MASK | LPIT_MCR_DOZE_EN_MASK;
 
     /* 6. Bật ngắt trong NVIC và khởi động timer */
-    NVIC->ISER[LPIT0_Ch0_IRQn / 32] = (1 << (LPIT0_Ch0_IRQn % 32));
+    HAL_IRQ_Enable(LPIT0_Ch0_IRQn);
     IP_LPIT0->TMR[0].TCTRL |= LPIT_TMR_TCTRL_T_EN_MASK;
 
 
@@ -13,8 +13,9 @@
 #define SOFTWARE_TIMER_H_
 
 #include "stdint.h"
-#include "my_nvic.h"
+#include "hal_irq.h"
 #include "S32K144.h"
+#include "time_base.h"
 
 #define MAX_SOFTWARE_TIMERS   10
 
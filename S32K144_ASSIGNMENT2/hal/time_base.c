@@ -0,0 +1,120 @@
+/**
+ * @file time_base.c
+ * @author benecosta2711
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include "time_base.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+#define TIME_US_PER_SECOND          1000000UL
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+/* Frequency of the LPIT functional clock, read back once the counter is started */
+static uint32_t s_timeFreq = 0U;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+uint8_t time_init(void)
+{
+    uint8_t retVal = 1U;
+
+    if ((IP_LPIT0->TMR[TIME_HIGH_CHANNEL].TCTRL & LPIT_TMR_TCTRL_T_EN_MASK) == 0U)
+    {
+        /* PCS may only be changed while the clock gate is disabled */
+        if ((IP_PCC->PCCn[PCC_LPIT_INDEX] & PCC_PCCn_CGC_MASK) == 0U)
+        {
+            IP_PCC->PCCn[PCC_LPIT_INDEX] = PCC_PCCn_PCS(HAL_CLOCK_PCS_SPLLDIV2);
+            IP_PCC->PCCn[PCC_LPIT_INDEX] |= PCC_PCCn_CGC_MASK;
+        }
+        else
+        {
+            /* Do nothing, keep the clock selected by the first user of LPIT */
+        }
+
+        /* No software reset here, other LPIT channels may already be in use */
+        IP_LPIT0->MCR |= LPIT_MCR_M_CEN_MASK | LPIT_MCR_DBG_EN_MASK | LPIT_MCR_DOZE_EN_MASK;
+
+        /* Both channels count down from the maximum, no interrupt */
+        IP_LPIT0->TMR[TIME_LOW_CHANNEL].TCTRL = LPIT_TMR_TCTRL_MODE(0);
+        IP_LPIT0->TMR[TIME_LOW_CHANNEL].TVAL = 0xFFFFFFFFUL;
+        IP_LPIT0->TMR[TIME_HIGH_CHANNEL].TCTRL = LPIT_TMR_TCTRL_MODE(0) | LPIT_TMR_TCTRL_CHAIN_MASK;
+        IP_LPIT0->TMR[TIME_HIGH_CHANNEL].TVAL = 0xFFFFFFFFUL;
+
+        /* Start both channels with one write */
+        IP_LPIT0->SETTEN = LPIT_SETTEN_SET_T_EN_2_MASK | LPIT_SETTEN_SET_T_EN_3_MASK;
+    }
+    else
+    {
+        /* Do nothing, already running */
+    }
+
+    s_timeFreq = HAL_CLOCK_GetPeripheralFreq(PCC_LPIT_INDEX);
+
+    if (0U == s_timeFreq)
+    {
+        retVal = 0U;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+
+    return retVal;
+}
+
+uint64_t time_now_cycles(void)
+{
+    uint32_t high = 0U;
+    uint32_t low = 0U;
+    uint32_t check = IP_LPIT0->TMR[TIME_HIGH_CHANNEL].CVAL;
+
+    /* Read the low word again if the high word moved in between */
+    do
+    {
+        high = check;
+        low = IP_LPIT0->TMR[TIME_LOW_CHANNEL].CVAL;
+        check = IP_LPIT0->TMR[TIME_HIGH_CHANNEL].CVAL;
+    } while (high != check);
+
+    /* Both channels count down from 0xFFFFFFFF */
+    return ((uint64_t)(~high) << 32) | (uint64_t)(~low);
+}
+
+uint64_t time_cycles_to_us(uint64_t cycles)
+{
+    uint64_t us = 0U;
+
+    if (0U != s_timeFreq)
+    {
+        /* Split in whole seconds and remainder, no overflow whatever the uptime */
+        us = ((cycles / s_timeFreq) * TIME_US_PER_SECOND)
+           + (((cycles % s_timeFreq) * TIME_US_PER_SECOND) / s_timeFreq);
+    }
+    else
+    {
+        /* Do nothing */
+    }
+
+    return us;
+}
+
+uint64_t time_now_us(void)
+{
+    return time_cycles_to_us(time_now_cycles());
+}
+
+uint32_t time_get_freq(void)
+{
+    return s_timeFreq;
+}
@@ -0,0 +1,80 @@
+/**
+ * @file time_base.h
+ * @author benecosta2711
+ * @brief A library provide the monotonic time base of the system ("now").
+ * Current version of this library support:
+ * - 64-bit free running counter built from LPIT channels 2 and 3 chained together,
+ *   counting the LPIT functional clock, it never wraps in practice.
+ * - Read without masking interrupts, the high word is read again to detect a carry.
+ * - Time in cycles and in microseconds, conversion helpers for timeouts.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#ifndef TIME_BASE_H_
+#define TIME_BASE_H_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "S32K144.h"
+#include "hal_clock.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/**
+ * @brief LPIT channels used by the time base, the low channel counts the functional
+ * clock and the high channel is chained on its timeouts.
+ */
+#define TIME_LOW_CHANNEL            2U
+#define TIME_HIGH_CHANNEL           3U
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+/**
+ * @brief Starts the time base.
+ * The LPIT module is clocked from SPLLDIV2 unless its clock gate is already enabled.
+ * Calling it again while the time base runs does nothing, so every user of "now"
+ * (software timer, UART, application) may call it during its own init.
+ *
+ * @return 1 if the time base runs, 0 if the LPIT functional clock is not valid.
+ */
+uint8_t time_init(void);
+
+/**
+ * @brief Gets the number of LPIT functional clock cycles since time_init.
+ *
+ * @return Elapsed cycles.
+ */
+uint64_t time_now_cycles(void);
+
+/**
+ * @brief Gets the number of microseconds since time_init.
+ *
+ * @return Elapsed microseconds.
+ */
+uint64_t time_now_us(void);
+
+/**
+ * @brief Gets the frequency of the time base.
+ *
+ * @return Frequency in Hz, 0 before time_init.
+ */
+uint32_t time_get_freq(void);
+
+/**
+ * @brief Converts a number of cycles of the time base to microseconds.
+ *
+ * @param cycles Number of cycles.
+ * @return Microseconds, rounded down.
+ */
+uint64_t time_cycles_to_us(uint64_t cycles);
+
+#endif /* TIME_BASE_H_ */
@@ -0,0 +1,157 @@
+/**
+ * @file bench_app_cmd.c
+ * @author benecosta2711
+ * @brief Host benchmark of the command lookup: the app_cmd hash index against the
+ * sequential strcmp chain it replaced, as the command table grows to 100+ entries.
+ * Host timings only compare the two lookups, they are not target cycle counts.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include <string.h>
+#include "test_common.h"
+#include "app_cmd.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/* Largest table, app_cmd keeps at least one empty slot in its index */
+#define BENCH_MAX_COMMANDS  (APP_CMD_HASH_SIZE - 8U)
+#define BENCH_NAME_SIZE     16U
+
+/* Lookups timed per table size */
+#define BENCH_LOOKUPS       2000000U
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+/* The project commands first, then generated ones of the same shape */
+static const char *const s_projectNames[] = {
+    "LED_STATUS", "HELP", "RED_ON", "RED_OFF", "GREEN_ON", "GREEN_OFF", "BLUE_ON", "BLUE_OFF"
+};
+
+static const uint32_t s_sizes[] = { 8U, 32U, 64U, 100U, BENCH_MAX_COMMANDS };
+
+static char s_names[BENCH_MAX_COMMANDS][BENCH_NAME_SIZE];
+static app_cmd_t s_table[BENCH_MAX_COMMANDS];
+
+/* Keeps the results alive so the loops are not optimized out */
+static volatile uintptr_t s_sink = 0U;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+static uint8_t bench_handler(const app_cmd_args_t *args)
+{
+    (void)args;
+
+    return APP_CMD_DONE;
+}
+
+/**
+ * @brief The lookup replaced by app_cmd: one strcmp per table entry, in table order.
+ */
+static const app_cmd_t *bench_strcmp_find(const char *line, uint32_t count)
+{
+    const app_cmd_t *cmd = NULL;
+    uint32_t i = 0U;
+
+    for (i = 0U; (i < count) && (NULL == cmd); i++)
+    {
+        if (strcmp(line, s_table[i].name) == 0)
+        {
+            cmd = &s_table[i];
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }
+
+    return cmd;
+}
+
+static double bench_hash(uint32_t count)
+{
+    uint64_t start = 0U;
+    uintptr_t sum = 0U;
+    uint32_t i = 0U;
+    uint32_t entry = 0U;
+
+    start = test_now_ns();
+    for (i = 0U; i < BENCH_LOOKUPS; i++)
+    {
+        sum += (uintptr_t)app_cmd_find(s_names[entry], (uint32_t)strlen(s_names[entry]));
+        entry = (entry + 1U == count) ? 0U : (entry + 1U);
+    }
+    s_sink = sum;
+
+    return (double)(test_now_ns() - start) / (double)BENCH_LOOKUPS;
+}
+
+static double bench_strcmp(uint32_t count)
+{
+    uint64_t start = 0U;
+    uintptr_t sum = 0U;
+    uint32_t i = 0U;
+    uint32_t entry = 0U;
+
+    start = test_now_ns();
+    for (i = 0U; i < BENCH_LOOKUPS; i++)
+    {
+        sum += (uintptr_t)bench_strcmp_find(s_names[entry], count);
+        entry = (entry + 1U == count) ? 0U : (entry + 1U);
+    }
+    s_sink = sum;
+
+    return (double)(test_now_ns() - start) / (double)BENCH_LOOKUPS;
+}
+
+int main(void)
+{
+    uint32_t i = 0U;
+    uint32_t count = 0U;
+
+    for (i = 0U; i < BENCH_MAX_COMMANDS; i++)
+    {
+        if (i < (sizeof(s_projectNames) / sizeof(s_projectNames[0])))
+        {
+            (void)snprintf(s_names[i], BENCH_NAME_SIZE, "%s", s_projectNames[i]);
+        }
+        else
+        {
+            (void)snprintf(s_names[i], BENCH_NAME_SIZE, "CH%03u_%s", (unsigned)i, ((i & 1U) != 0U) ? "ON" : "OFF");
+        }
+
+        s_table[i].name = s_names[i];
+        s_table[i].handler = bench_handler;
+        s_table[i].schema = "";
+    }
+
+    printf("bench_app_cmd: %u lookups per size, hash index of %u slots\n", BENCH_LOOKUPS, APP_CMD_HASH_SIZE);
+    printf("  commands   hash ns/lookup   strcmp ns/lookup\n");
+
+    for (i = 0U; i < (sizeof(s_sizes) / sizeof(s_sizes[0])); i++)
+    {
+        count = s_sizes[i];
+        TEST_CHECK(app_cmd_init(s_table, count) == APP_CMD_OK);
+
+        /* Both lookups find every entry and reject an unknown name */
+        TEST_CHECK(app_cmd_find(s_names[count - 1U], (uint32_t)strlen(s_names[count - 1U])) == &s_table[count - 1U]);
+        TEST_CHECK(bench_strcmp_find(s_names[count - 1U], count) == &s_table[count - 1U]);
+        TEST_CHECK(app_cmd_find("PURPLE_ON", 9U) == NULL);
+
+        printf("  %8u   %14.2f   %16.2f\n", (unsigned)count, bench_hash(count), bench_strcmp(count));
+    }
+
+    /* The index must keep an empty slot */
+    TEST_CHECK(app_cmd_init(s_table, APP_CMD_HASH_SIZE) == APP_CMD_ERROR);
+
+    return TEST_RESULT("bench_app_cmd");
+}
@@ -0,0 +1,102 @@
+/**
+ * @file bench_ring_buffer.c
+ * @author benecosta2711
+ * @brief Host benchmark of the ring buffer: byte by byte (ISR side) against bulk (main loop side).
+ * Host timings only compare the two access patterns, they are not target cycle counts.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include "test_common.h"
+#include "ring_buffer.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+#define BENCH_RING_SIZE     128U
+#define BENCH_TOTAL_BYTES   (16UL * 1024UL * 1024UL)
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+static ring_buffer_t s_ring;
+static uint8_t s_storage[BENCH_RING_SIZE];
+
+/* Keeps the data read alive so the loops are not optimized out */
+static volatile uint32_t s_sink = 0U;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+static double bench_bytewise(void)
+{
+    uint64_t start = 0U;
+    uint32_t moved = 0U;
+    uint32_t sum = 0U;
+    uint32_t i = 0U;
+    uint8_t data = 0U;
+
+    (void)RingBuffer_Init(&s_ring, s_storage, BENCH_RING_SIZE);
+
+    start = test_now_ns();
+    while (moved < BENCH_TOTAL_BYTES)
+    {
+        for (i = 0U; i < (BENCH_RING_SIZE / 2U); i++)
+        {
+            (void)RingBuffer_Put(&s_ring, (uint8_t)i);
+        }
+        while (RingBuffer_Get(&s_ring, &data) != 0U)
+        {
+            sum += data;
+            moved++;
+        }
+    }
+    s_sink = sum;
+
+    return (double)(test_now_ns() - start) / (double)moved;
+}
+
+static double bench_bulk(uint32_t chunk)
+{
+    uint8_t in[BENCH_RING_SIZE];
+    uint8_t out[BENCH_RING_SIZE];
+    uint64_t start = 0U;
+    uint32_t moved = 0U;
+    uint32_t sum = 0U;
+    uint32_t i = 0U;
+
+    for (i = 0U; i < BENCH_RING_SIZE; i++)
+    {
+        in[i] = (uint8_t)i;
+    }
+
+    (void)RingBuffer_Init(&s_ring, s_storage, BENCH_RING_SIZE);
+
+    start = test_now_ns();
+    while (moved < BENCH_TOTAL_BYTES)
+    {
+        (void)RingBuffer_Write(&s_ring, in, chunk);
+        moved += RingBuffer_Read(&s_ring, out, chunk);
+        sum += out[0];
+    }
+    s_sink = sum;
+
+    return (double)(test_now_ns() - start) / (double)moved;
+}
+
+int main(void)
+{
+    printf("bench_ring_buffer: %lu bytes through a %u byte ring\n", BENCH_TOTAL_BYTES, BENCH_RING_SIZE);
+    printf("  Put/Get byte by byte : %6.2f ns/byte\n", bench_bytewise());
+    printf("  Write/Read 16 bytes  : %6.2f ns/byte\n", bench_bulk(16U));
+    printf("  Write/Read 64 bytes  : %6.2f ns/byte\n", bench_bulk(64U));
+
+    /* Every run ends with the ring drained */
+    TEST_CHECK(RingBuffer_GetCount(&s_ring) == 0U);
+
+    return TEST_RESULT("bench_ring_buffer");
+}
@@ -0,0 +1,155 @@
+/**
+ * @file bench_uart_fifo.c
+ * @author benecosta2711
+ * @brief Host benchmark of the LPUART interrupt load: FIFOs disabled against FIFO mode
+ * with several watermarks, counted with HAL_UART_GetInterruptCount on the simulated LPUART.
+ * The counts follow the register model, not host timing, so they match the target.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include "test_common.h"
+#include "hal_uart.h"
+#include "sim_lpuart.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+#define BENCH_INSTANCE      HAL_LPUART0
+#define BENCH_BAUDRATE      115200U
+
+/* Bytes moved per direction and per configuration */
+#define BENCH_BYTES         4096U
+
+/* RX bursts, the line goes idle between two of them */
+#define BENCH_RX_BURST      64U
+
+/**
+ * @brief One configuration under test, fifoEnabled 0 keeps one byte per interrupt.
+ */
+typedef struct
+{
+    const char *name;
+    uint8_t fifoEnabled;
+    hal_uart_fifo_config_t fifo;
+} bench_uart_case_t;
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+static const bench_uart_case_t s_cases[] = {
+    { "FIFO disabled     ", 0U, { 0U, 0U, HAL_UART_RX_IDLE_DISABLED } },
+    { "FIFO tx 0 / rx 0  ", 1U, { 0U, 0U, HAL_UART_RX_IDLE_1_CHAR } },
+    { "FIFO tx 1 / rx 1  ", 1U, { 1U, 1U, HAL_UART_RX_IDLE_1_CHAR } },
+    { "FIFO tx 1 / rx 2  ", 1U, { 1U, 2U, HAL_UART_RX_IDLE_1_CHAR } },
+    { "FIFO tx 2 / rx 3  ", 1U, { 2U, 3U, HAL_UART_RX_IDLE_1_CHAR } }
+};
+
+static uint8_t s_data[BENCH_BYTES];
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+static void bench_setup(const bench_uart_case_t *benchCase)
+{
+    const hal_uart_config_t config = {
+        .baudRate = BENCH_BAUDRATE,
+        .dataBits = HAL_UART_DATA_BITS_8,
+        .parity = HAL_UART_PARITY_NONE,
+        .stopBits = HAL_UART_STOP_BITS_1
+    };
+
+    SimLpuart_Reset(BENCH_INSTANCE);
+
+    TEST_CHECK(HAL_UART_Init(BENCH_INSTANCE) == 1U);
+    TEST_CHECK(HAL_UART_Configure(BENCH_INSTANCE, &config) == 1U);
+
+    if (0U != benchCase->fifoEnabled)
+    {
+        TEST_CHECK(HAL_UART_ConfigureFifo(BENCH_INSTANCE, &benchCase->fifo) == 1U);
+    }
+    else
+    {
+        HAL_UART_DisableFifo(BENCH_INSTANCE);
+    }
+
+    HAL_UART_EnableTransmitter(BENCH_INSTANCE, 1U);
+    HAL_UART_EnableReceiver(BENCH_INSTANCE, 1U);
+}
+
+/**
+ * @brief Receives BENCH_BYTES in bursts through the buffered RX path.
+ *
+ * @return Interrupts per byte.
+ */
+static double bench_receive(const bench_uart_case_t *benchCase)
+{
+    uint8_t out[BENCH_RX_BURST];
+    uint32_t start = 0U;
+    uint32_t received = 0U;
+    uint32_t sent = 0U;
+
+    bench_setup(benchCase);
+    TEST_CHECK(HAL_UART_StartBufferedReceive(BENCH_INSTANCE) == 1U);
+
+    start = HAL_UART_GetInterruptCount(BENCH_INSTANCE);
+    while (sent < BENCH_BYTES)
+    {
+        TEST_CHECK(SimLpuart_Receive(BENCH_INSTANCE, &s_data[sent], BENCH_RX_BURST) == 0U);
+        sent += BENCH_RX_BURST;
+        received += HAL_UART_ReadBuffered(BENCH_INSTANCE, out, sizeof(out));
+    }
+
+    /* The idle flush must deliver the words left under the watermark */
+    TEST_CHECK(received == BENCH_BYTES);
+
+    HAL_UART_StopBufferedReceive(BENCH_INSTANCE);
+
+    return (double)(HAL_UART_GetInterruptCount(BENCH_INSTANCE) - start) / (double)BENCH_BYTES;
+}
+
+/**
+ * @brief Sends BENCH_BYTES with one interrupt driven block send.
+ *
+ * @return Interrupts per byte.
+ */
+static double bench_send(const bench_uart_case_t *benchCase)
+{
+    uint32_t start = 0U;
+
+    bench_setup(benchCase);
+
+    start = HAL_UART_GetInterruptCount(BENCH_INSTANCE);
+    TEST_CHECK(HAL_UART_Send(BENCH_INSTANCE, s_data, BENCH_BYTES) == 1U);
+    /* Run past the last byte so the completion interrupt is counted too */
+    TEST_CHECK(SimLpuart_Transmit(BENCH_INSTANCE, NULL, BENCH_BYTES + 1U) == BENCH_BYTES);
+    TEST_CHECK(HAL_UART_IsTxBusy(BENCH_INSTANCE) == 0U);
+
+    return (double)(HAL_UART_GetInterruptCount(BENCH_INSTANCE) - start) / (double)BENCH_BYTES;
+}
+
+int main(void)
+{
+    uint32_t i = 0U;
+
+    for (i = 0U; i < BENCH_BYTES; i++)
+    {
+        s_data[i] = (uint8_t)i;
+    }
+
+    printf("bench_uart_fifo: %u bytes per direction, FIFO depth %lu, RX bursts of %u\n",
+           BENCH_BYTES, SIM_LPUART_FIFO_DEPTH, BENCH_RX_BURST);
+    printf("  configuration        RX irq/byte  TX irq/byte\n");
+
+    for (i = 0U; i < (sizeof(s_cases) / sizeof(s_cases[0])); i++)
+    {
+        printf("  %s   %8.3f     %8.3f\n", s_cases[i].name,
+               bench_receive(&s_cases[i]), bench_send(&s_cases[i]));
+    }
+
+    return TEST_RESULT("bench_uart_fifo");
+}
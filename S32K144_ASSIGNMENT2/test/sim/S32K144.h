@@ -0,0 +1,54 @@
+/**
+ * @file S32K144.h
+ * @author benecosta2711
+ * @brief Host build of the device header.
+ * Includes the real register definitions, then points the peripherals used by the
+ * host tests to register blocks in RAM (sim_periph.c) instead of the device addresses.
+ * Must come before ../include in the include path.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#ifndef SIM_S32K144_H_
+#define SIM_S32K144_H_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "../../include/S32K144.h"
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+extern LPUART_Type sim_lpuart[LPUART_INSTANCE_COUNT];
+extern PORT_Type sim_port[PORT_INSTANCE_COUNT];
+extern PCC_Type sim_pcc;
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+#undef IP_LPUART0
+#undef IP_LPUART1
+#undef IP_LPUART2
+#define IP_LPUART0      (&sim_lpuart[0])
+#define IP_LPUART1      (&sim_lpuart[1])
+#define IP_LPUART2      (&sim_lpuart[2])
+
+#undef IP_PORTA
+#undef IP_PORTB
+#undef IP_PORTC
+#undef IP_PORTD
+#undef IP_PORTE
+#define IP_PORTA        (&sim_port[0])
+#define IP_PORTB        (&sim_port[1])
+#define IP_PORTC        (&sim_port[2])
+#define IP_PORTD        (&sim_port[3])
+#define IP_PORTE        (&sim_port[4])
+
+#undef IP_PCC
+#define IP_PCC          (&sim_pcc)
+
+#endif /* SIM_S32K144_H_ */
@@ -0,0 +1,303 @@
+/**
+ * @file sim_lpuart.c
+ * @author benecosta2711
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include <string.h>
+#include "sim_lpuart.h"
+#include "hal_uart.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/* Value left in DATA before a TX interrupt, the HAL only writes 8-bit values */
+#define SIM_LPUART_DATA_UNTOUCHED   0xFFFFFFFFUL
+
+/* Upper bound of character times per byte, stops a handler that never clears TIE */
+#define SIM_LPUART_MAX_IDLE_STEPS   16U
+
+/**
+ * @brief Line state of one instance, the registers hold the rest.
+ */
+typedef struct
+{
+    uint32_t    rxLevel;        /* Words in the RX FIFO (or the RX data register) */
+    uint32_t    txLevel;        /* Words in the TX FIFO (or the TX data register) */
+    uint8_t     txHold;         /* Last byte written, valid with the FIFOs disabled */
+} sim_lpuart_line_t;
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+void LPUART0_RxTx_IRQHandler(void);
+void LPUART1_RxTx_IRQHandler(void);
+void LPUART2_RxTx_IRQHandler(void);
+
+static void SimLpuart_RunIrq(uint32_t instance);
+static void SimLpuart_UpdateStatus(uint32_t instance, uint8_t rxIdle);
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+static void (*const s_irqHandler[LPUART_INSTANCE_COUNT])(void) = {
+    LPUART0_RxTx_IRQHandler,
+    LPUART1_RxTx_IRQHandler,
+    LPUART2_RxTx_IRQHandler
+};
+
+static sim_lpuart_line_t s_line[LPUART_INSTANCE_COUNT];
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+void SimLpuart_Reset(uint32_t instance)
+{
+    LPUART_Type * base = &sim_lpuart[instance];
+
+    memset((void *)base, 0, sizeof(*base));
+    memset(&s_line[instance], 0, sizeof(s_line[instance]));
+
+    /* PARAM is read-only for the driver */
+    *(volatile uint32_t *)&base->PARAM = LPUART_PARAM_TXFIFO(SIM_LPUART_FIFO_DEPTH_LOG2)
+                                       | LPUART_PARAM_RXFIFO(SIM_LPUART_FIFO_DEPTH_LOG2);
+    base->STAT = LPUART_STAT_TDRE_MASK | LPUART_STAT_TC_MASK;
+}
+
+uint32_t SimLpuart_Receive(uint32_t instance, const uint8_t *data, uint32_t length)
+{
+    LPUART_Type * base = &sim_lpuart[instance];
+    sim_lpuart_line_t * line = &s_line[instance];
+    uint32_t lost = 0U;
+    uint32_t depth = 0U;
+    uint32_t i = 0U;
+
+    for (i = 0U; i < length; i++)
+    {
+        depth = ((base->FIFO & LPUART_FIFO_RXFE_MASK) != 0U) ? SIM_LPUART_FIFO_DEPTH : 1U;
+
+        if (line->rxLevel == depth)
+        {
+            base->STAT |= LPUART_STAT_OR_MASK;
+            lost++;
+        }
+        else
+        {
+            line->rxLevel++;
+            base->DATA = (uint32_t)data[i];
+        }
+
+        SimLpuart_UpdateStatus(instance, 0U);
+        SimLpuart_RunIrq(instance);
+    }
+
+    /* Line idle after the frame: STAT[IDLE] is set, RXIDEN raises RDRF for the words left under the watermark */
+    if (length != 0U)
+    {
+        base->STAT |= LPUART_STAT_IDLE_MASK;
+        SimLpuart_UpdateStatus(instance, ((base->FIFO & LPUART_FIFO_RXIDEN_MASK) != 0U) ? 1U : 0U);
+        SimLpuart_RunIrq(instance);
+    }
+    else
+    {
+        /* Do nothing */
+    }
+
+    return lost;
+}
+
+uint32_t SimLpuart_Transmit(uint32_t instance, uint8_t *data, uint32_t maxLength)
+{
+    LPUART_Type * base = &sim_lpuart[instance];
+    sim_lpuart_line_t * line = &s_line[instance];
+    uint32_t sent = 0U;
+    uint32_t written = 0U;
+    uint32_t idleSteps = 0U;
+    uint32_t txCount = 0U;
+    uint8_t blockBusy = 0U;
+
+    while ((sent < maxLength) && (idleSteps < SIM_LPUART_MAX_IDLE_STEPS))
+    {
+        SimLpuart_UpdateStatus(instance, 0U);
+
+        if (((base->STAT & LPUART_STAT_TDRE_MASK) != 0U) && ((base->CTRL & LPUART_CTRL_TIE_MASK) != 0U))
+        {
+            blockBusy = HAL_UART_IsTxBusy(instance);
+            txCount = HAL_UART_GetTxCount(instance);
+            base->DATA = SIM_LPUART_DATA_UNTOUCHED;
+
+            SimLpuart_RunIrq(instance);
+
+            if (0U == (base->FIFO & LPUART_FIFO_TXFE_MASK))
+            {
+                /* At most one write per interrupt, block or ring data alike */
+                written = (SIM_LPUART_DATA_UNTOUCHED != base->DATA) ? 1U : 0U;
+            }
+            else if (blockBusy != 0U)
+            {
+                written = HAL_UART_GetTxCount(instance) - txCount;
+            }
+            else
+            {
+                /* Ring data through the FIFO is not modelled */
+                written = 0U;
+            }
+
+            line->txHold = (uint8_t)base->DATA;
+            line->txLevel += written;
+        }
+        else
+        {
+            /* Do nothing */
+        }
+
+        /* One character time: the shifter takes the oldest word */
+        if (line->txLevel != 0U)
+        {
+            if ((NULL != data) && (0U == (base->FIFO & LPUART_FIFO_TXFE_MASK)))
+            {
+                data[sent] = line->txHold;
+            }
+            else
+            {
+                /* Do nothing */
+            }
+
+            line->txLevel--;
+            sent++;
+            idleSteps = 0U;
+        }
+        else if (0U == (base->CTRL & LPUART_CTRL_TIE_MASK))
+        {
+            /* Nothing queued and nothing left to fill */
+            break;
+        }
+        else
+        {
+            idleSteps++;
+        }
+    }
+
+    SimLpuart_UpdateStatus(instance, 0U);
+
+    return sent;
+}
+
+/**
+ * @brief Calls the IRQ handler if an enabled flag is set, as the NVIC would.
+ * The handler is assumed to read every word announced in RXCOUNT.
+ */
+static void SimLpuart_RunIrq(uint32_t instance)
+{
+    LPUART_Type * base = &sim_lpuart[instance];
+    uint32_t ctrl = base->CTRL;
+    uint32_t stat = base->STAT;
+    uint8_t rxPending = 0U;
+    uint8_t idlePending = 0U;
+
+    rxPending = (((stat & LPUART_STAT_RDRF_MASK) != 0U) && ((ctrl & LPUART_CTRL_RIE_MASK) != 0U)) ? 1U : 0U;
+    idlePending = (((stat & LPUART_STAT_IDLE_MASK) != 0U) && ((ctrl & LPUART_CTRL_ILIE_MASK) != 0U)) ? 1U : 0U;
+
+    if ((0U != rxPending) || (0U != idlePending)
+        || (((stat & LPUART_STAT_TDRE_MASK) != 0U) && ((ctrl & LPUART_CTRL_TIE_MASK) != 0U))
+        || ((stat & LPUART_STAT_OR_MASK) != 0U))
+    {
+        s_irqHandler[instance]();
+
+        /* OR and IDLE are write-1-to-clear, the handler acknowledges them */
+        base->STAT &= ~LPUART_STAT_OR_MASK;
+
+        if (0U != idlePending)
+        {
+            base->STAT &= ~LPUART_STAT_IDLE_MASK;
+        }
+        else
+        {
+            /* Do nothing */
+        }
+
+        if ((0U != rxPending) || ((0U != idlePending) && ((ctrl & LPUART_CTRL_RIE_MASK) != 0U)))
+        {
+            s_line[instance].rxLevel = 0U;
+        }
+        else
+        {
+            /* Do nothing */
+        }
+
+        SimLpuart_UpdateStatus(instance, 0U);
+    }
+    else
+    {
+        /* Do nothing */
+    }
+}
+
+/**
+ * @brief Updates STAT and the WATER counters from the FIFO levels.
+ */
+static void SimLpuart_UpdateStatus(uint32_t instance, uint8_t rxIdle)
+{
+    LPUART_Type * base = &sim_lpuart[instance];
+    sim_lpuart_line_t * line = &s_line[instance];
+    uint32_t water = base->WATER;
+    uint32_t txWater = 0U;
+    uint32_t rxWater = 0U;
+    uint32_t stat = base->STAT & ~(LPUART_STAT_TDRE_MASK | LPUART_STAT_TC_MASK | LPUART_STAT_RDRF_MASK);
+
+    if ((base->FIFO & LPUART_FIFO_TXFE_MASK) != 0U)
+    {
+        txWater = (water & LPUART_WATER_TXWATER_MASK) >> LPUART_WATER_TXWATER_SHIFT;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+
+    if ((base->FIFO & LPUART_FIFO_RXFE_MASK) != 0U)
+    {
+        rxWater = (water & LPUART_WATER_RXWATER_MASK) >> LPUART_WATER_RXWATER_SHIFT;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+
+    if (line->txLevel <= txWater)
+    {
+        stat |= LPUART_STAT_TDRE_MASK;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+
+    if (0U == line->txLevel)
+    {
+        stat |= LPUART_STAT_TC_MASK;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+
+    if ((line->rxLevel > rxWater) || ((0U != rxIdle) && (line->rxLevel != 0U)))
+    {
+        stat |= LPUART_STAT_RDRF_MASK;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+
+    base->STAT = stat;
+    base->WATER = (water & ~(LPUART_WATER_TXCOUNT_MASK | LPUART_WATER_RXCOUNT_MASK))
+                | LPUART_WATER_TXCOUNT(line->txLevel)
+                | LPUART_WATER_RXCOUNT(line->rxLevel);
+}
@@ -0,0 +1,73 @@
+/**
+ * @file sim_lpuart.h
+ * @author benecosta2711
+ * @brief Host model of the LPUART line, driving the real hal_uart.c interrupt handler.
+ * The model works one character time at a time:
+ * - RX: a received byte enters the RX FIFO, RDRF is raised once RXCOUNT is above the
+ *   RX watermark (or the line goes idle with RXIDEN set) and the IRQ handler is called.
+ * - TX: TDRE is raised while TXCOUNT is not above the TX watermark, the IRQ handler is
+ *   called and one byte leaves the TX FIFO per character time.
+ * The registers are plain RAM, a DATA access has no side effect. Byte values are only
+ * checked with the FIFOs disabled (one byte per interrupt), in FIFO mode the model
+ * counts bytes and interrupts only.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#ifndef SIM_LPUART_H_
+#define SIM_LPUART_H_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "S32K144.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/**
+ * @brief FIFO depth of the S32K144 LPUART, as 2^PARAM[TXFIFO/RXFIFO] words.
+ */
+#define SIM_LPUART_FIFO_DEPTH_LOG2  2U
+#define SIM_LPUART_FIFO_DEPTH       (1UL << SIM_LPUART_FIFO_DEPTH_LOG2)
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+/**
+ * @brief Resets the registers of an instance to their reset values, FIFOs empty.
+ * Must be called before HAL_UART_Init.
+ *
+ * @param instance The virtual UART instance.
+ */
+void SimLpuart_Reset(uint32_t instance);
+
+/**
+ * @brief Receives bytes on the RX line, calling the IRQ handler as the hardware would.
+ * The line goes idle after the last byte, which flushes a partial RX FIFO when RXIDEN is set.
+ *
+ * @param instance The virtual UART instance.
+ * @param data Bytes arriving on the line.
+ * @param length Number of bytes.
+ * @return Number of bytes lost in an RX overrun (STAT[OR]).
+ */
+uint32_t SimLpuart_Receive(uint32_t instance, const uint8_t *data, uint32_t length);
+
+/**
+ * @brief Runs the TX line until the transmitter has nothing left to send.
+ * With the FIFOs disabled every byte is seen (block send and ring data). With the TX FIFO
+ * enabled the bytes are counted from HAL_UART_GetTxCount, so only block sends are modelled.
+ *
+ * @param instance The virtual UART instance.
+ * @param data Destination of the bytes sent, only filled with the FIFOs disabled. May be NULL.
+ * @param maxLength Maximum number of bytes to send.
+ * @return Number of bytes sent on the line.
+ */
+uint32_t SimLpuart_Transmit(uint32_t instance, uint8_t *data, uint32_t maxLength);
+
+#endif /* SIM_LPUART_H_ */
@@ -0,0 +1,145 @@
+/**
+ * @file sim_stubs.c
+ * @author benecosta2711
+ * @brief Host replacements of the register blocks and of the system services
+ * (NVIC, eDMA, clocks, time base) used by the modules under test.
+ * No DMA transfer is ever started by the host tests, the eDMA functions only
+ * accept the calls.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include "S32K144.h"
+#include "hal_irq.h"
+#include "hal_dma.h"
+#include "hal_clock.h"
+#include "time_base.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/* Functional clock reported for every peripheral (SIRCDIV2) */
+#define SIM_PERIPHERAL_FREQ     8000000UL
+
+/* Time base frequency, one cycle per microsecond */
+#define SIM_TIME_FREQ           1000000UL
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+LPUART_Type sim_lpuart[LPUART_INSTANCE_COUNT];
+PORT_Type sim_port[PORT_INSTANCE_COUNT];
+PCC_Type sim_pcc;
+
+/* Every read of the time base moves it forward, so a timeout loop always ends */
+static uint64_t s_simCycles = 0U;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+void HAL_IRQ_SetPriorityGrouping(uint32_t grouping)
+{
+    (void)grouping;
+}
+
+void HAL_IRQ_SetPriority(IRQn_Type irq, uint32_t priority)
+{
+    (void)irq;
+    (void)priority;
+}
+
+uint32_t HAL_IRQ_GetTablePriority(IRQn_Type irq)
+{
+    (void)irq;
+
+    return HAL_IRQ_PRIO_LOWEST;
+}
+
+void HAL_IRQ_Enable(IRQn_Type irq)
+{
+    (void)irq;
+}
+
+void HAL_IRQ_Disable(IRQn_Type irq)
+{
+    (void)irq;
+}
+
+void HAL_DMA_Init(void)
+{
+}
+
+uint8_t HAL_DMA_ConfigureChannel(uint32_t channel, uint8_t request, const hal_dma_transfer_t *transfer, HAL_DMA_Callback_t callback)
+{
+    (void)channel;
+    (void)request;
+    (void)transfer;
+    (void)callback;
+
+    return 0U;
+}
+
+void HAL_DMA_StartChannel(uint32_t channel)
+{
+    (void)channel;
+}
+
+void HAL_DMA_StopChannel(uint32_t channel)
+{
+    (void)channel;
+}
+
+uint32_t HAL_DMA_GetRemainingCount(uint32_t channel)
+{
+    (void)channel;
+
+    return 0U;
+}
+
+uint32_t HAL_CLOCK_GetDiv2Freq(hal_clock_pcs_t pcs)
+{
+    (void)pcs;
+
+    return SIM_PERIPHERAL_FREQ;
+}
+
+uint32_t HAL_CLOCK_GetPeripheralFreq(uint32_t pccIndex)
+{
+    (void)pccIndex;
+
+    return SIM_PERIPHERAL_FREQ;
+}
+
+uint8_t time_init(void)
+{
+    s_simCycles = 0U;
+
+    return 1U;
+}
+
+uint64_t time_now_cycles(void)
+{
+    s_simCycles++;
+
+    return s_simCycles;
+}
+
+uint64_t time_now_us(void)
+{
+    return time_cycles_to_us(time_now_cycles());
+}
+
+uint32_t time_get_freq(void)
+{
+    return SIM_TIME_FREQ;
+}
+
+uint64_t time_cycles_to_us(uint64_t cycles)
+{
+    return (cycles * 1000000UL) / SIM_TIME_FREQ;
+}
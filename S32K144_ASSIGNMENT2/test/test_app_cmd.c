@@ -0,0 +1,97 @@
+/**
+ * @file test_app_cmd.c
+ * @author benecosta2711
+ * @brief Host tests of the command registry: lookup, duplicated names and argument parsing.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include <string.h>
+#include "test_common.h"
+#include "app_cmd.h"
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+static uint8_t test_handler(const app_cmd_args_t *args)
+{
+    (void)args;
+
+    return APP_CMD_DONE;
+}
+
+static const app_cmd_t s_table[] = {
+    {"HELP",    test_handler, ""},
+    {"SET",     test_handler, "uu"},
+    {"BLINK",   test_handler, "u"}
+};
+
+static uint8_t test_parse(const char *line, const app_cmd_t **cmd, app_cmd_args_t *args)
+{
+    return app_cmd_parse((const uint8_t *)line, (uint32_t)strlen(line), cmd, args);
+}
+
+static void test_lookup(void)
+{
+    TEST_CHECK(app_cmd_init(s_table, 3U) == APP_CMD_OK);
+    TEST_CHECK(app_cmd_find("SET", 3U) == &s_table[1]);
+    TEST_CHECK(app_cmd_find("SETX", 4U) == NULL);
+    TEST_CHECK(app_cmd_find("SE", 2U) == NULL);
+}
+
+static void test_duplicated_name(void)
+{
+    const app_cmd_t duplicated[] = {
+        {"HELP",    test_handler, ""},
+        {"SET",     test_handler, ""},
+        {"HELP",    test_handler, "u"}
+    };
+
+    /* Rejected, and the registry is left without a table */
+    TEST_CHECK(app_cmd_init(duplicated, 3U) == APP_CMD_ERROR);
+    TEST_CHECK(app_cmd_find("HELP", 4U) == NULL);
+
+    /* A valid table registered afterwards is not affected by the rejected one */
+    TEST_CHECK(app_cmd_init(s_table, 3U) == APP_CMD_OK);
+    TEST_CHECK(app_cmd_find("HELP", 4U) == &s_table[0]);
+}
+
+static void test_arguments(void)
+{
+    const app_cmd_t *cmd = NULL;
+    app_cmd_args_t args;
+
+    TEST_CHECK(app_cmd_init(s_table, 3U) == APP_CMD_OK);
+
+    TEST_CHECK(test_parse("SET 12  345", &cmd, &args) == APP_CMD_OK);
+    TEST_CHECK((cmd == &s_table[1]) && (args.count == 2U));
+    TEST_CHECK((args.value[0] == 12U) && (args.value[1] == 345U));
+
+    TEST_CHECK(test_parse("HELP", &cmd, &args) == APP_CMD_OK);
+    TEST_CHECK(test_parse("PURPLE", &cmd, &args) == APP_CMD_NOT_FOUND);
+    TEST_CHECK(test_parse("SET 1", &cmd, &args) == APP_CMD_BAD_ARGS);
+    TEST_CHECK(test_parse("SET 1 2 3", &cmd, &args) == APP_CMD_BAD_ARGS);
+    TEST_CHECK(test_parse("BLINK 1x", &cmd, &args) == APP_CMD_BAD_ARGS);
+
+    /* UINT32_MAX is the largest value accepted, one more is rejected instead of wrapping */
+    TEST_CHECK(test_parse("BLINK 4294967295", &cmd, &args) == APP_CMD_OK);
+    TEST_CHECK(args.value[0] == UINT32_MAX);
+    TEST_CHECK(test_parse("BLINK 4294967296", &cmd, &args) == APP_CMD_BAD_ARGS);
+    TEST_CHECK(test_parse("BLINK 99999999999", &cmd, &args) == APP_CMD_BAD_ARGS);
+    TEST_CHECK(test_parse("BLINK 0004294967295", &cmd, &args) == APP_CMD_OK);
+}
+
+int main(void)
+{
+    printf("test_app_cmd\n");
+
+    TEST_RUN(test_lookup);
+    TEST_RUN(test_duplicated_name);
+    TEST_RUN(test_arguments);
+
+    return TEST_RESULT("test_app_cmd");
+}
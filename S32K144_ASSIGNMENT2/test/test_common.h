@@ -0,0 +1,79 @@
+/**
+ * @file test_common.h
+ * @author benecosta2711
+ * @brief Minimal check and timing helpers shared by the host tests and benchmarks.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#ifndef TEST_COMMON_H_
+#define TEST_COMMON_H_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <stdio.h>
+#include <stdint.h>
+#include <time.h>
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/**
+ * @brief Records a failed check and keeps running, so one run reports every failure.
+ */
+#define TEST_CHECK(cond)                                                        \
+    do                                                                          \
+    {                                                                           \
+        if (!(cond))                                                            \
+        {                                                                       \
+            printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond);     \
+            s_testFailures++;                                                   \
+        }                                                                       \
+    } while (0)
+
+/**
+ * @brief Runs one test function and prints its name.
+ */
+#define TEST_RUN(test)                                                          \
+    do                                                                          \
+    {                                                                           \
+        printf("  %s\n", #test);                                                \
+        test();                                                                 \
+    } while (0)
+
+/**
+ * @brief Prints the result and gives the process exit code.
+ */
+#define TEST_RESULT(name)                                                       \
+    ((0U == s_testFailures) ? (printf("%s: PASS\n", (name)), 0)                 \
+                            : (printf("%s: %u FAILED\n", (name), (unsigned)s_testFailures), 1))
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+static uint32_t s_testFailures = 0U;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+/**
+ * @brief Reads a monotonic time stamp for the benchmarks.
+ *
+ * @return Time in nanoseconds.
+ */
+static inline uint64_t test_now_ns(void)
+{
+    struct timespec ts;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ((uint64_t)ts.tv_sec * 1000000000ULL) + (uint64_t)ts.tv_nsec;
+}
+
+#endif /* TEST_COMMON_H_ */
@@ -0,0 +1,229 @@
+/**
+ * @file test_hal_uart.c
+ * @author benecosta2711
+ * @brief Host tests of the buffered (ring buffer) mode and of the RX idle line of hal_uart.c
+ * on the simulated LPUART.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include <string.h>
+#include "test_common.h"
+#include "hal_uart.h"
+#include "sim_lpuart.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+#define TEST_INSTANCE       HAL_LPUART0
+#define TEST_BAUDRATE       115200U
+
+/* Larger than the rings so every test wraps their indexes */
+#define TEST_STREAM_LENGTH  (3U * HAL_UART_RX_RING_SIZE + 17U)
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+static volatile uint32_t s_events = 0U;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+static void test_callback(uint32_t event)
+{
+    s_events |= event;
+}
+
+static void test_setup(void)
+{
+    const hal_uart_config_t config = {
+        .baudRate = TEST_BAUDRATE,
+        .dataBits = HAL_UART_DATA_BITS_8,
+        .parity = HAL_UART_PARITY_NONE,
+        .stopBits = HAL_UART_STOP_BITS_1
+    };
+
+    SimLpuart_Reset(TEST_INSTANCE);
+    s_events = 0U;
+
+    TEST_CHECK(HAL_UART_Init(TEST_INSTANCE) == 1U);
+    TEST_CHECK(HAL_UART_Configure(TEST_INSTANCE, &config) == 1U);
+    HAL_UART_DisableFifo(TEST_INSTANCE);
+    HAL_UART_RegisterCallback(TEST_INSTANCE, test_callback);
+    HAL_UART_EnableTransmitter(TEST_INSTANCE, 1U);
+    HAL_UART_EnableReceiver(TEST_INSTANCE, 1U);
+}
+
+static void test_buffered_receive_in_batches(void)
+{
+    uint8_t stream[TEST_STREAM_LENGTH];
+    uint8_t out[TEST_STREAM_LENGTH];
+    uint32_t received = 0U;
+    uint32_t sent = 0U;
+    uint32_t chunk = 0U;
+    uint32_t i = 0U;
+
+    test_setup();
+
+    for (i = 0U; i < TEST_STREAM_LENGTH; i++)
+    {
+        stream[i] = (uint8_t)((i * 7U) + 3U);
+    }
+
+    TEST_CHECK(HAL_UART_StartBufferedReceive(TEST_INSTANCE) == 1U);
+
+    /* The ISR fills the ring, the main loop drains it in batches of varying size */
+    while (sent < TEST_STREAM_LENGTH)
+    {
+        chunk = ((TEST_STREAM_LENGTH - sent) < 50U) ? (TEST_STREAM_LENGTH - sent) : 50U;
+        TEST_CHECK(SimLpuart_Receive(TEST_INSTANCE, &stream[sent], chunk) == 0U);
+        sent += chunk;
+
+        TEST_CHECK(HAL_UART_GetRxBufferedCount(TEST_INSTANCE) == (sent - received));
+        received += HAL_UART_ReadBuffered(TEST_INSTANCE, &out[received], 33U);
+        received += HAL_UART_ReadBuffered(TEST_INSTANCE, &out[received], TEST_STREAM_LENGTH - received);
+    }
+
+    TEST_CHECK(received == TEST_STREAM_LENGTH);
+    TEST_CHECK(memcmp(out, stream, TEST_STREAM_LENGTH) == 0);
+    TEST_CHECK(0U == (s_events & ARM_USART_EVENT_RX_OVERFLOW));
+
+    /* One interrupt per byte with the FIFOs disabled */
+    TEST_CHECK(HAL_UART_GetInterruptCount(TEST_INSTANCE) >= TEST_STREAM_LENGTH);
+
+    HAL_UART_StopBufferedReceive(TEST_INSTANCE);
+}
+
+static void test_buffered_receive_overflow(void)
+{
+    uint8_t stream[HAL_UART_RX_RING_SIZE + 10U];
+    uint8_t out[HAL_UART_RX_RING_SIZE + 10U];
+    uint32_t i = 0U;
+
+    test_setup();
+
+    for (i = 0U; i < sizeof(stream); i++)
+    {
+        stream[i] = (uint8_t)i;
+    }
+
+    TEST_CHECK(HAL_UART_StartBufferedReceive(TEST_INSTANCE) == 1U);
+
+    /* Nobody drains the ring: the bytes above its size are reported and dropped */
+    (void)SimLpuart_Receive(TEST_INSTANCE, stream, sizeof(stream));
+
+    TEST_CHECK((s_events & ARM_USART_EVENT_RX_OVERFLOW) != 0U);
+    TEST_CHECK(HAL_UART_GetRxBufferedCount(TEST_INSTANCE) == HAL_UART_RX_RING_SIZE);
+    TEST_CHECK(HAL_UART_ReadBuffered(TEST_INSTANCE, out, sizeof(out)) == HAL_UART_RX_RING_SIZE);
+    TEST_CHECK(memcmp(out, stream, HAL_UART_RX_RING_SIZE) == 0);
+
+    HAL_UART_StopBufferedReceive(TEST_INSTANCE);
+}
+
+static void test_fifo_idle_closes_frame(void)
+{
+    const hal_uart_fifo_config_t fifoConfig = {
+        .txWatermark = 0U,
+        .rxWatermark = 1U,
+        .rxIdle = HAL_UART_RX_IDLE_1_CHAR
+    };
+    const uint8_t aboveWatermark[] = { 'R', 'E', 'D', ' ', 'O', 'N' };
+    const uint8_t underWatermark[] = { 'B', 'L', 'U', 'E', ' ', 'O', 'N' };
+    uint8_t out[sizeof(underWatermark)];
+
+    /* The simulated FIFO holds one data word, only the byte counts are checked */
+    test_setup();
+    TEST_CHECK(HAL_UART_ConfigureFifo(TEST_INSTANCE, &fifoConfig) == 1U);
+    TEST_CHECK(HAL_UART_StartBufferedReceive(TEST_INSTANCE) == 1U);
+
+    /* The last two bytes push RXCOUNT above the watermark: RDRF empties the FIFO, only IDLE is left */
+    TEST_CHECK(SimLpuart_Receive(TEST_INSTANCE, aboveWatermark, sizeof(aboveWatermark)) == 0U);
+    TEST_CHECK((s_events & ARM_USART_EVENT_RX_TIMEOUT) != 0U);
+    TEST_CHECK(HAL_UART_ReadBuffered(TEST_INSTANCE, out, sizeof(out)) == sizeof(aboveWatermark));
+
+    /* The last byte stays under the watermark: it is read before the frame is reported closed */
+    s_events = 0U;
+    TEST_CHECK(SimLpuart_Receive(TEST_INSTANCE, underWatermark, sizeof(underWatermark)) == 0U);
+    TEST_CHECK((s_events & ARM_USART_EVENT_RX_TIMEOUT) != 0U);
+    TEST_CHECK(HAL_UART_ReadBuffered(TEST_INSTANCE, out, sizeof(out)) == sizeof(underWatermark));
+
+    /* No idle time configured: no frame end is reported */
+    HAL_UART_StopBufferedReceive(TEST_INSTANCE);
+    test_setup();
+    TEST_CHECK(HAL_UART_StartBufferedReceive(TEST_INSTANCE) == 1U);
+    TEST_CHECK(SimLpuart_Receive(TEST_INSTANCE, aboveWatermark, sizeof(aboveWatermark)) == 0U);
+    TEST_CHECK(0U == (s_events & ARM_USART_EVENT_RX_TIMEOUT));
+
+    HAL_UART_StopBufferedReceive(TEST_INSTANCE);
+}
+
+static void test_buffered_transmit(void)
+{
+    uint8_t stream[TEST_STREAM_LENGTH];
+    uint8_t line[TEST_STREAM_LENGTH];
+    uint32_t queued = 0U;
+    uint32_t sent = 0U;
+    uint32_t i = 0U;
+
+    test_setup();
+
+    for (i = 0U; i < TEST_STREAM_LENGTH; i++)
+    {
+        stream[i] = (uint8_t)(0xA5U ^ i);
+    }
+
+    /* Queue as much as the ring takes, let the line drain part of it, repeat */
+    while (sent < TEST_STREAM_LENGTH)
+    {
+        queued += HAL_UART_WriteBuffered(TEST_INSTANCE, &stream[queued], TEST_STREAM_LENGTH - queued);
+        TEST_CHECK((queued - sent) <= HAL_UART_TX_RING_SIZE);
+        TEST_CHECK((sim_lpuart[TEST_INSTANCE].CTRL & LPUART_CTRL_TIE_MASK) != 0U);
+
+        sent += SimLpuart_Transmit(TEST_INSTANCE, &line[sent], 40U);
+    }
+
+    TEST_CHECK(queued == TEST_STREAM_LENGTH);
+    TEST_CHECK(memcmp(line, stream, TEST_STREAM_LENGTH) == 0);
+
+    /* Ring empty: the ISR turns TDRE interrupts off */
+    TEST_CHECK(SimLpuart_Transmit(TEST_INSTANCE, line, TEST_STREAM_LENGTH) == 0U);
+    TEST_CHECK(0U == (sim_lpuart[TEST_INSTANCE].CTRL & LPUART_CTRL_TIE_MASK));
+}
+
+static void test_block_send_then_ring(void)
+{
+    const uint8_t block[] = "block";
+    const uint8_t ring[] = "ring";
+    uint8_t line[16] = { 0U };
+    uint32_t sent = 0U;
+
+    test_setup();
+
+    /* Ring data queued during a block send goes out right after it */
+    TEST_CHECK(HAL_UART_Send(TEST_INSTANCE, block, 5U) == 1U);
+    TEST_CHECK(HAL_UART_WriteBuffered(TEST_INSTANCE, ring, 4U) == 4U);
+
+    sent = SimLpuart_Transmit(TEST_INSTANCE, line, sizeof(line));
+
+    TEST_CHECK(sent == 9U);
+    TEST_CHECK(memcmp(line, "blockring", 9U) == 0);
+    TEST_CHECK((s_events & ARM_USART_EVENT_SEND_COMPLETE) != 0U);
+    TEST_CHECK(HAL_UART_IsTxBusy(TEST_INSTANCE) == 0U);
+}
+
+int main(void)
+{
+    printf("test_hal_uart\n");
+
+    TEST_RUN(test_buffered_receive_in_batches);
+    TEST_RUN(test_buffered_receive_overflow);
+    TEST_RUN(test_fifo_idle_closes_frame);
+    TEST_RUN(test_buffered_transmit);
+    TEST_RUN(test_block_send_then_ring);
+
+    return TEST_RESULT("test_hal_uart");
+}
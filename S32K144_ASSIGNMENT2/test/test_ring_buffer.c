@@ -0,0 +1,206 @@
+/**
+ * @file test_ring_buffer.c
+ * @author benecosta2711
+ * @brief Host tests of the SPSC ring buffer: sizes, full/empty, wrap-around and bulk access.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include <string.h>
+#include "test_common.h"
+#include "ring_buffer.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+#define TEST_RING_SIZE      8U
+
+/* Number of random operations compared against the reference queue */
+#define TEST_RANDOM_STEPS   100000U
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+static ring_buffer_t s_ring;
+static uint8_t s_storage[TEST_RING_SIZE];
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+static void test_init_rejects_bad_sizes(void)
+{
+    TEST_CHECK(RingBuffer_Init(NULL, s_storage, TEST_RING_SIZE) == 0U);
+    TEST_CHECK(RingBuffer_Init(&s_ring, NULL, TEST_RING_SIZE) == 0U);
+    TEST_CHECK(RingBuffer_Init(&s_ring, s_storage, 0U) == 0U);
+    TEST_CHECK(RingBuffer_Init(&s_ring, s_storage, 6U) == 0U);
+    TEST_CHECK(RingBuffer_Init(&s_ring, s_storage, 1U) == 1U);
+    TEST_CHECK(RingBuffer_Init(&s_ring, s_storage, TEST_RING_SIZE) == 1U);
+}
+
+static void test_empty_and_full(void)
+{
+    uint8_t data = 0U;
+    uint32_t i = 0U;
+
+    (void)RingBuffer_Init(&s_ring, s_storage, TEST_RING_SIZE);
+
+    TEST_CHECK(RingBuffer_GetCount(&s_ring) == 0U);
+    TEST_CHECK(RingBuffer_GetFree(&s_ring) == TEST_RING_SIZE);
+    TEST_CHECK(RingBuffer_Get(&s_ring, &data) == 0U);
+    TEST_CHECK(RingBuffer_Read(&s_ring, &data, 1U) == 0U);
+
+    for (i = 0U; i < TEST_RING_SIZE; i++)
+    {
+        TEST_CHECK(RingBuffer_Put(&s_ring, (uint8_t)i) == 1U);
+    }
+
+    /* Full: all slots are usable, the next byte is refused */
+    TEST_CHECK(RingBuffer_GetCount(&s_ring) == TEST_RING_SIZE);
+    TEST_CHECK(RingBuffer_GetFree(&s_ring) == 0U);
+    TEST_CHECK(RingBuffer_Put(&s_ring, 0xAAU) == 0U);
+    TEST_CHECK(RingBuffer_Write(&s_ring, &data, 1U) == 0U);
+
+    for (i = 0U; i < TEST_RING_SIZE; i++)
+    {
+        TEST_CHECK(RingBuffer_Get(&s_ring, &data) == 1U);
+        TEST_CHECK(data == (uint8_t)i);
+    }
+
+    TEST_CHECK(RingBuffer_GetCount(&s_ring) == 0U);
+    TEST_CHECK(RingBuffer_Get(&s_ring, &data) == 0U);
+
+    /* Reset drops pending data */
+    (void)RingBuffer_Put(&s_ring, 1U);
+    RingBuffer_Reset(&s_ring);
+    TEST_CHECK(RingBuffer_GetCount(&s_ring) == 0U);
+}
+
+static void test_bulk_wrap_around(void)
+{
+    const uint8_t pattern[TEST_RING_SIZE] = { 10U, 11U, 12U, 13U, 14U, 15U, 16U, 17U };
+    uint8_t out[TEST_RING_SIZE] = { 0U };
+    uint8_t data = 0U;
+    uint32_t i = 0U;
+
+    (void)RingBuffer_Init(&s_ring, s_storage, TEST_RING_SIZE);
+
+    /* Move the indexes to 5 so the next bulk write crosses the end of the storage */
+    for (i = 0U; i < 5U; i++)
+    {
+        (void)RingBuffer_Put(&s_ring, 0U);
+        (void)RingBuffer_Get(&s_ring, &data);
+    }
+
+    TEST_CHECK(RingBuffer_Write(&s_ring, pattern, 6U) == 6U);
+    TEST_CHECK(RingBuffer_GetCount(&s_ring) == 6U);
+    TEST_CHECK(RingBuffer_Read(&s_ring, out, 6U) == 6U);
+    TEST_CHECK(memcmp(out, pattern, 6U) == 0);
+
+    /* Bulk calls are clipped to the free space and to the stored data */
+    TEST_CHECK(RingBuffer_Write(&s_ring, pattern, 3U) == 3U);
+    TEST_CHECK(RingBuffer_Write(&s_ring, pattern, TEST_RING_SIZE) == (TEST_RING_SIZE - 3U));
+    TEST_CHECK(RingBuffer_GetFree(&s_ring) == 0U);
+
+    memset(out, 0, sizeof(out));
+    TEST_CHECK(RingBuffer_Read(&s_ring, out, 2U) == 2U);
+    TEST_CHECK((out[0] == 10U) && (out[1] == 11U));
+    TEST_CHECK(RingBuffer_Read(&s_ring, out, TEST_RING_SIZE) == (TEST_RING_SIZE - 2U));
+    TEST_CHECK(out[0] == 12U);
+    TEST_CHECK(memcmp(&out[1], pattern, TEST_RING_SIZE - 3U) == 0);
+    TEST_CHECK(RingBuffer_Read(&s_ring, out, TEST_RING_SIZE) == 0U);
+}
+
+static void test_index_overflow(void)
+{
+    const uint8_t pattern[TEST_RING_SIZE] = { 1U, 2U, 3U, 4U, 5U, 6U, 7U, 8U };
+    uint8_t out[TEST_RING_SIZE] = { 0U };
+
+    (void)RingBuffer_Init(&s_ring, s_storage, TEST_RING_SIZE);
+
+    /* Free running indexes close to the 32-bit limit, the difference must stay valid */
+    s_ring.head = 0xFFFFFFFCUL;
+    s_ring.tail = 0xFFFFFFFCUL;
+
+    TEST_CHECK(RingBuffer_Write(&s_ring, pattern, TEST_RING_SIZE) == TEST_RING_SIZE);
+    TEST_CHECK(RingBuffer_GetCount(&s_ring) == TEST_RING_SIZE);
+    TEST_CHECK(RingBuffer_GetFree(&s_ring) == 0U);
+    TEST_CHECK(RingBuffer_Put(&s_ring, 0U) == 0U);
+    TEST_CHECK(RingBuffer_Read(&s_ring, out, TEST_RING_SIZE) == TEST_RING_SIZE);
+    TEST_CHECK(memcmp(out, pattern, TEST_RING_SIZE) == 0);
+    TEST_CHECK(s_ring.head == 4U);
+}
+
+static void test_random_against_reference(void)
+{
+    uint8_t reference[TEST_RANDOM_STEPS];
+    uint8_t chunk[TEST_RING_SIZE + 3U];
+    uint32_t refHead = 0U;
+    uint32_t refTail = 0U;
+    uint32_t seed = 12345U;
+    uint32_t step = 0U;
+    uint32_t length = 0U;
+    uint32_t done = 0U;
+    uint32_t i = 0U;
+    uint8_t nextByte = 0U;
+    uint8_t data = 0U;
+
+    (void)RingBuffer_Init(&s_ring, s_storage, TEST_RING_SIZE);
+
+    for (step = 0U; (step < TEST_RANDOM_STEPS) && (refHead < TEST_RANDOM_STEPS - sizeof(chunk)); step++)
+    {
+        seed = (seed * 1103515245U) + 12345U;
+        length = (seed >> 16) % sizeof(chunk);
+
+        switch ((seed >> 8) & 3U)
+        {
+        case 0U:
+            for (i = 0U; i < length; i++)
+            {
+                chunk[i] = nextByte++;
+            }
+            done = RingBuffer_Write(&s_ring, chunk, length);
+            memcpy(&reference[refHead], chunk, done);
+            refHead += done;
+            nextByte = (uint8_t)(nextByte - (length - done));
+            break;
+        case 1U:
+            done = RingBuffer_Read(&s_ring, chunk, length);
+            TEST_CHECK(memcmp(chunk, &reference[refTail], done) == 0);
+            refTail += done;
+            break;
+        case 2U:
+            if (RingBuffer_Put(&s_ring, nextByte) != 0U)
+            {
+                reference[refHead++] = nextByte++;
+            }
+            break;
+        default:
+            if (RingBuffer_Get(&s_ring, &data) != 0U)
+            {
+                TEST_CHECK(data == reference[refTail]);
+                refTail++;
+            }
+            break;
+        }
+
+        TEST_CHECK(RingBuffer_GetCount(&s_ring) == (refHead - refTail));
+        TEST_CHECK((RingBuffer_GetCount(&s_ring) + RingBuffer_GetFree(&s_ring)) == TEST_RING_SIZE);
+    }
+}
+
+int main(void)
+{
+    printf("test_ring_buffer\n");
+
+    TEST_RUN(test_init_rejects_bad_sizes);
+    TEST_RUN(test_empty_and_full);
+    TEST_RUN(test_bulk_wrap_around);
+    TEST_RUN(test_index_overflow);
+    TEST_RUN(test_random_against_reference);
+
+    return TEST_RESULT("test_ring_buffer");
+}
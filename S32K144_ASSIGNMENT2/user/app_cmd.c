@@ -0,0 +1,251 @@
+/**
+ * @file app_cmd.c
+ * @author benecosta2711
+ * @brief
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+#include "app_cmd.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+/* FNV-1a 32 bit parameters */
+#define APP_CMD_FNV_OFFSET      2166136261UL
+#define APP_CMD_FNV_PRIME       16777619UL
+
+/* Empty slot of the hash index */
+#define APP_CMD_HASH_EMPTY      0xFFU
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+/* Registered command table */
+static const app_cmd_t *cmdTable = NULL;
+
+/* Open addressing hash index, each slot holds a command table index */
+static uint8_t cmdHashIndex[APP_CMD_HASH_SIZE];
+
+/*******************************************************************************
+ * Function Prototypes
+ ******************************************************************************/
+static uint32_t app_cmd_hash(const char *name, uint32_t length);
+static uint8_t app_cmd_name_equal(const char *cmdName, const char *name, uint32_t length);
+
+/*******************************************************************************
+ * Function Definitions
+ ******************************************************************************/
+static uint32_t app_cmd_hash(const char *name, uint32_t length)
+{
+    uint32_t hash = APP_CMD_FNV_OFFSET;
+    uint32_t i = 0;
+
+    for (i = 0; i < length; i++)
+    {
+        hash ^= (uint8_t)name[i];
+        hash *= APP_CMD_FNV_PRIME;
+    }
+
+    return hash;
+}
+
+/* Compare a NUL terminated command name against a name that is not terminated */
+static uint8_t app_cmd_name_equal(const char *cmdName, const char *name, uint32_t length)
+{
+    uint32_t i = 0;
+
+    while ((i < length) && (cmdName[i] == name[i]))
+    {
+        i++;
+    }
+
+    return ((i == length) && ('\0' == cmdName[i])) ? 1 : 0;
+}
+
+uint8_t app_cmd_init(const app_cmd_t *table, uint32_t count)
+{
+    uint8_t retVal = APP_CMD_OK;
+    uint32_t i = 0;
+    uint32_t length = 0;
+    uint32_t slot = 0;
+
+    /* Keep at least one empty slot so a failed lookup always stops */
+    if ((NULL == table) || (count >= APP_CMD_HASH_SIZE) || (count >= APP_CMD_HASH_EMPTY))
+    {
+        retVal = APP_CMD_ERROR;
+    }
+    else
+    {
+        memset(cmdHashIndex, APP_CMD_HASH_EMPTY, sizeof(cmdHashIndex));
+
+        for (i = 0; (i < count) && (APP_CMD_OK == retVal); i++)
+        {
+            length = strlen(table[i].name);
+            slot = app_cmd_hash(table[i].name, length) & (APP_CMD_HASH_SIZE - 1);
+
+            /* Linear probing, duplicated names are rejected */
+            while ((APP_CMD_HASH_EMPTY != cmdHashIndex[slot]) && (APP_CMD_OK == retVal))
+            {
+                if (app_cmd_name_equal(table[cmdHashIndex[slot]].name, table[i].name, length) != 0)
+                {
+                    retVal = APP_CMD_ERROR;
+                }
+                else
+                {
+                    slot = (slot + 1) & (APP_CMD_HASH_SIZE - 1);
+                }
+            }
+
+            /* A duplicated name leaves the index untouched */
+            if (APP_CMD_OK == retVal)
+            {
+                cmdHashIndex[slot] = (uint8_t)i;
+            }
+            else
+            {
+                /* Do nothing */
+            }
+        }
+
+        cmdTable = (APP_CMD_OK == retVal) ? table : NULL;
+    }
+
+    return retVal;
+}
+
+const app_cmd_t *app_cmd_find(const char *name, uint32_t length)
+{
+    const app_cmd_t *cmd = NULL;
+    uint32_t slot = 0;
+
+    if ((NULL != cmdTable) && (NULL != name))
+    {
+        slot = app_cmd_hash(name, length) & (APP_CMD_HASH_SIZE - 1);
+
+        while ((NULL == cmd) && (APP_CMD_HASH_EMPTY != cmdHashIndex[slot]))
+        {
+            if (app_cmd_name_equal(cmdTable[cmdHashIndex[slot]].name, name, length) != 0)
+            {
+                cmd = &cmdTable[cmdHashIndex[slot]];
+            }
+            else
+            {
+                slot = (slot + 1) & (APP_CMD_HASH_SIZE - 1);
+            }
+        }
+    }
+    else
+    {
+        /* Do nothing */
+    }
+
+    return cmd;
+}
+
+uint8_t app_cmd_parse(const uint8_t *line, uint32_t length, const app_cmd_t **cmd, app_cmd_args_t *args)
+{
+    uint8_t retVal = APP_CMD_OK;
+    const char *text = (const char *)line;
+    uint32_t pos = 0;
+    uint32_t start = 0;
+    uint32_t argIndex = 0;
+    uint32_t number = 0;
+    uint32_t digit = 0;
+
+    if ((NULL == line) || (NULL == cmd) || (NULL == args))
+    {
+        retVal = APP_CMD_ERROR;
+    }
+    else
+    {
+        args->count = 0;
+
+        /* Command name: first word of the line */
+        while ((pos < length) && (' ' != text[pos]))
+        {
+            pos++;
+        }
+
+        *cmd = app_cmd_find(text, pos);
+
+        if (NULL == *cmd)
+        {
+            retVal = APP_CMD_NOT_FOUND;
+        }
+        else
+        {
+            /* One word per schema character */
+            while ((APP_CMD_OK == retVal) && (pos < length))
+            {
+                while ((pos < length) && (' ' == text[pos]))
+                {
+                    pos++;
+                }
+
+                if (pos < length)
+                {
+                    start = pos;
+                    number = 0;
+
+                    if ((argIndex >= APP_CMD_MAX_ARGS) || (APP_CMD_ARG_UINT != (*cmd)->schema[argIndex]))
+                    {
+                        retVal = APP_CMD_BAD_ARGS;
+                    }
+                    else
+                    {
+                        while ((APP_CMD_OK == retVal) && (pos < length) && (text[pos] >= '0') && (text[pos] <= '9'))
+                        {
+                            digit = (uint32_t)(text[pos] - '0');
+
+                            /* A number above UINT32_MAX is rejected instead of wrapping */
+                            if (number > ((UINT32_MAX - digit) / 10))
+                            {
+                                retVal = APP_CMD_BAD_ARGS;
+                            }
+                            else
+                            {
+                                number = (number * 10) + digit;
+                                pos++;
+                            }
+                        }
+
+                        if (APP_CMD_OK != retVal)
+                        {
+                            /* Do nothing, number too large */
+                        }
+                        else if ((pos == start) || ((pos < length) && (' ' != text[pos])))
+                        {
+                            retVal = APP_CMD_BAD_ARGS;
+                        }
+                        else
+                        {
+                            args->value[argIndex] = number;
+                            argIndex++;
+                        }
+                    }
+                }
+                else
+                {
+                    /* Do nothing, trailing spaces */
+                }
+            }
+
+            /* Every argument of the schema must be present */
+            if ((APP_CMD_OK == retVal) && ('\0' != (*cmd)->schema[argIndex]))
+            {
+                retVal = APP_CMD_BAD_ARGS;
+            }
+            else
+            {
+                /* Do nothing */
+            }
+
+            args->count = argIndex;
+        }
+    }
+
+    return retVal;
+}
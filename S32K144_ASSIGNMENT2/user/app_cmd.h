@@ -0,0 +1,78 @@
+/**
+ * @file app_cmd.h
+ * @author benecosta2711
+ * @brief A library provide a table-driven command registry for the main application, including:
+ * - Register a table of commands, each entry maps a name to a handler and an argument schema.
+ * - Find a command by name through a hash index built once at init, lookup cost is O(name length).
+ * - Parse a received line (name followed by space separated arguments) in place, without copies.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+#ifndef APP_CMD_H_
+#define APP_CMD_H_
+
+#include "S32K144.h"
+#include "stddef.h"
+#include "string.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+/* Define command registry error code */
+#define APP_CMD_ERROR               0
+#define APP_CMD_OK                  1
+#define APP_CMD_NOT_FOUND           2
+#define APP_CMD_BAD_ARGS            3
+
+/* Define handler result: done, or keep the command pending and run it again later */
+#define APP_CMD_DONE                0
+#define APP_CMD_RETRY               1
+
+/* Maximum number of arguments of a command */
+#define APP_CMD_MAX_ARGS            4
+
+/* Size of the hash index, power of two and larger than the number of commands */
+#define APP_CMD_HASH_SIZE           128
+
+/*
+ * Argument schema characters, one per argument:
+ * 'u': unsigned decimal number.
+ * An empty schema ("") means the command takes no argument.
+ */
+#define APP_CMD_ARG_UINT            'u'
+
+/*******************************************************************************
+ * Structures
+ ******************************************************************************/
+/* Arguments parsed from a command line */
+typedef struct
+{
+    uint32_t count;
+    uint32_t value[APP_CMD_MAX_ARGS];
+} app_cmd_args_t;
+
+/* Command handler, returns APP_CMD_DONE or APP_CMD_RETRY */
+typedef uint8_t (*app_cmd_handler_t)(const app_cmd_args_t *args);
+
+/* One entry of the command table */
+typedef struct
+{
+    const char *name;               /* Command name, first word of the line */
+    app_cmd_handler_t handler;      /* Function executing the command */
+    const char *schema;             /* Argument schema, see APP_CMD_ARG_* */
+} app_cmd_t;
+
+/*******************************************************************************
+ * Function Prototypes
+ ******************************************************************************/
+/* Build the hash index of a command table, the table must stay valid, duplicated names are rejected */
+uint8_t app_cmd_init(const app_cmd_t *table, uint32_t count);
+/* Find a command by name, NULL if not registered */
+const app_cmd_t *app_cmd_find(const char *name, uint32_t length);
+/* Find the command of a line and parse its arguments against the schema, numbers above UINT32_MAX are bad arguments */
+uint8_t app_cmd_parse(const uint8_t *line, uint32_t length, const app_cmd_t **cmd, app_cmd_args_t *args);
+
+#endif /* APP_CMD_H_ */
@@ -0,0 +1,150 @@
+/**
+ * @file app_event.c
+ * @author benecosta2711
+ * @brief
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+#include "app_event.h"
+#include "hal_irq.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+#define APP_EVENT_QUEUE_MASK        (APP_EVENT_QUEUE_SIZE - 1)
+
+/*
+ * Several producers may post (main loop and interrupts), so a post is done inside a
+ * hal_irq critical section. Producers must run at or below HAL_IRQ_PRIO_CRITICAL, the
+ * UART ISR above it is not delayed by a post.
+ */
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+/* Head is written by producers inside the critical section, tail only by the consumer */
+static app_event_t eventQueue[APP_EVENT_QUEUE_SIZE];
+static volatile uint32_t eventHead = 0;
+static volatile uint32_t eventTail = 0;
+
+static volatile app_event_stats_t eventStats;
+
+/*******************************************************************************
+ * Function Definitions
+ ******************************************************************************/
+void app_event_init(void)
+{
+    eventHead = 0;
+    eventTail = 0;
+
+    eventStats.posted = 0;
+    eventStats.processed = 0;
+    eventStats.overflow = 0;
+    eventStats.highWater = 0;
+}
+
+uint8_t app_event_post(const app_cmd_t *cmd, const app_cmd_args_t *args)
+{
+    uint8_t retVal = APP_EVENT_OK;
+    uint32_t irqState = 0;
+    uint32_t count = 0;
+    app_event_t *event = NULL;
+
+    if ((NULL == cmd) || (NULL == args))
+    {
+        retVal = APP_EVENT_ERROR;
+    }
+    else
+    {
+        HAL_IRQ_ENTER_CRITICAL(irqState);
+
+        count = eventHead - eventTail;
+
+        if (count >= APP_EVENT_QUEUE_SIZE)
+        {
+            eventStats.overflow++;
+            retVal = APP_EVENT_FULL;
+        }
+        else
+        {
+            event = &eventQueue[eventHead & APP_EVENT_QUEUE_MASK];
+            event->cmd = cmd;
+            event->args = *args;
+            eventHead++;
+
+            eventStats.posted++;
+            if ((count + 1) > eventStats.highWater)
+            {
+                eventStats.highWater = count + 1;
+            }
+            else
+            {
+                /* Do nothing */
+            }
+        }
+
+        HAL_IRQ_EXIT_CRITICAL(irqState);
+    }
+
+    return retVal;
+}
+
+uint8_t app_event_peek(app_event_t **event)
+{
+    uint8_t retVal = APP_EVENT_EMPTY;
+    uint32_t tail = eventTail;
+
+    if (NULL == event)
+    {
+        retVal = APP_EVENT_ERROR;
+    }
+    else if (eventHead != tail)
+    {
+        *event = &eventQueue[tail & APP_EVENT_QUEUE_MASK];
+        retVal = APP_EVENT_OK;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+
+    return retVal;
+}
+
+void app_event_pop(void)
+{
+    if (eventHead != eventTail)
+    {
+        /* The event is fully consumed before its slot is released */
+        __asm volatile ("" : : : "memory");
+        eventTail++;
+        eventStats.processed++;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+}
+
+uint32_t app_event_get_count(void)
+{
+    return eventHead - eventTail;
+}
+
+void app_event_get_stats(app_event_stats_t *stats)
+{
+    if (NULL != stats)
+    {
+        stats->posted = eventStats.posted;
+        stats->processed = eventStats.processed;
+        stats->overflow = eventStats.overflow;
+        stats->highWater = eventStats.highWater;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+}
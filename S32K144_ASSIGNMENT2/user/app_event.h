@@ -0,0 +1,64 @@
+/**
+ * @file app_event.h
+ * @author benecosta2711
+ * @brief A library provide the event queue feeding the main application FSM, including:
+ * - Fixed capacity queue of events, each event is a command with its parsed arguments.
+ * - Post is safe from the main loop and from interrupts, the FSM is the only consumer.
+ * - Statistics: events posted and processed, posts rejected on a full queue, high water mark.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+#ifndef APP_EVENT_H_
+#define APP_EVENT_H_
+
+#include "S32K144.h"
+#include "stddef.h"
+#include "app_cmd.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+/* Define event queue error code */
+#define APP_EVENT_ERROR             0
+#define APP_EVENT_OK                1
+#define APP_EVENT_FULL              2
+#define APP_EVENT_EMPTY             3
+
+/* Number of events the queue holds, must be a power of two */
+#define APP_EVENT_QUEUE_SIZE        8
+
+/*******************************************************************************
+ * Structures
+ ******************************************************************************/
+/* One event: the command to run and its arguments */
+typedef struct
+{
+    const app_cmd_t *cmd;
+    app_cmd_args_t args;
+} app_event_t;
+
+/* Event queue statistics */
+typedef struct
+{
+    uint32_t posted;                /* Events accepted */
+    uint32_t processed;             /* Events removed by the consumer */
+    uint32_t overflow;              /* Posts rejected because the queue was full */
+    uint32_t highWater;             /* Maximum number of events queued at once */
+} app_event_stats_t;
+
+/*******************************************************************************
+ * Function Prototypes
+ ******************************************************************************/
+void app_event_init(void);
+/* Copy an event into the queue, APP_EVENT_FULL when no room is left */
+uint8_t app_event_post(const app_cmd_t *cmd, const app_cmd_args_t *args);
+/* Get the oldest event without removing it, valid until app_event_pop */
+uint8_t app_event_peek(app_event_t **event);
+void app_event_pop(void);
+uint32_t app_event_get_count(void);
+void app_event_get_stats(app_event_stats_t *stats);
+
+#endif /* APP_EVENT_H_ */
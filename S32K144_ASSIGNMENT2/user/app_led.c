@@ -20,11 +20,22 @@ ARM_DRIVER_GPIO *gpio_drv = &Driver_GPIO0;
 /* Manage led status */
 static uint32_t ledStatus = 0;
 
+/* All leds in one group, bit i of a group mask is ledPins[i] (not the virtual pin number) */
+static const uint32_t ledPins[LED_NUM] = { PIN_LED_BLUE, PIN_LED_RED, PIN_LED_GREEN };
+static hal_gpio_group_t ledGroup;
+
+/*******************************************************************************
+ * Function Prototypes
+ ******************************************************************************/
+static uint32_t app_led_to_group_mask(uint32_t ledMask);
+
 /*******************************************************************************
  * Function Definitions
  ******************************************************************************/
-void app_led_init(void)
+uint8_t app_led_init(void)
 {
+    uint8_t retVal = APP_LED_OK;
+
     gpio_drv->Setup(PIN_LED_RED, NULL);
     gpio_drv->SetDirection(PIN_LED_RED, ARM_GPIO_OUTPUT);
     gpio_drv->SetOutput(PIN_LED_RED, 1);
@@ -36,22 +47,59 @@ void app_led_init(void)
     gpio_drv->Setup(PIN_LED_BLUE, NULL);
     gpio_drv->SetDirection(PIN_LED_BLUE, ARM_GPIO_OUTPUT);
     gpio_drv->SetOutput(PIN_LED_BLUE, 1);
-}
 
-void app_led_control(uint8_t led, uint8_t cmd)
-{
-    gpio_drv->SetOutput(led, cmd);
-    if (LED_ON == cmd)
+    if (HAL_GPIO_InitGroup(&ledGroup, ledPins, LED_NUM) == false)
     {
-        ledStatus |= (1 << led);
+        retVal = APP_LED_ERROR;
     }
     else
     {
-        ledStatus &= ~(1 << led);
+        /* Do nothing */
     }
+
+    return retVal;
+}
+
+void app_led_control(uint8_t led, uint8_t cmd)
+{
+    app_led_set((1UL << led), (TURN_ON == cmd) ? (1UL << led) : 0U);
+}
+
+void app_led_set(uint32_t ledMask, uint32_t onMask)
+{
+    ledMask &= LED_ALL_STATE_MSK;
+    onMask &= ledMask;
+
+    /* Leds are active low: a led to turn on is written low */
+    HAL_GPIO_WriteGroup(&ledGroup, app_led_to_group_mask(ledMask), app_led_to_group_mask(ledMask & ~onMask));
+
+    ledStatus = (ledStatus & ~ledMask) | onMask;
 }
 
 uint32_t app_led_get_status(void)
 {
     return ledStatus;
 }
+
+/**
+ * @brief Converts a mask indexed by led virtual pin (LED_*_STATE_MSK) to a mask indexed by position in ledPins.
+ */
+static uint32_t app_led_to_group_mask(uint32_t ledMask)
+{
+    uint32_t groupMask = 0U;
+    uint32_t i = 0U;
+
+    for (i = 0U; i < LED_NUM; i++)
+    {
+        if ((ledMask & (1UL << ledPins[i])) != 0U)
+        {
+            groupMask |= (1UL << i);
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }
+
+    return groupMask;
+}
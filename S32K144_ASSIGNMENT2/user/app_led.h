@@ -15,6 +15,7 @@
 #define APP_LED_H_
 #include "S32K144.h"
 #include "Driver_GPIO.h"
+#include "hal_gpio.h"
 #include "string.h"
 
 /*******************************************************************************
@@ -24,10 +25,7 @@
 #define APP_LED_ERROR 	0
 #define APP_LED_OK 		1
 
-/* Define led pin used in this application */
-#define PIN_LED_BLUE 		0
-#define PIN_LED_RED 		1
-#define PIN_LED_GREEN 		2
+/* Led pins PIN_LED_BLUE, PIN_LED_RED and PIN_LED_GREEN come from the board table in board_pins.h */
 
 /* Led status mask*/
 #define LED_BLUE_STATE_MSK	(1 << PIN_LED_BLUE)
@@ -35,6 +33,7 @@
 #define LED_GREEN_STATE_MSK	(1 << PIN_LED_GREEN)
 
 #define LED_NUM 3
+#define LED_ALL_STATE_MSK	(LED_BLUE_STATE_MSK | LED_RED_STATE_MSK | LED_GREEN_STATE_MSK)
 
 /* Control led command, all the led on S32K144 EVB is active low */
 #define TURN_OFF 1
@@ -47,8 +46,28 @@
 /*******************************************************************************
  * Function Prototypes
  ******************************************************************************/
-void app_led_init(void);
+/**
+ * @brief Init the led pins (all off) and the group used to write them together.
+ *
+ * @return uint8_t APP_LED_OK, or APP_LED_ERROR if the led group cannot be built.
+ */
+uint8_t app_led_init(void);
+
+/**
+ * @brief Turn one led on or off.
+ *
+ * @param led Led virtual pin (PIN_LED_*).
+ * @param cmd TURN_ON or TURN_OFF.
+ */
 void app_led_control(uint8_t led, uint8_t cmd);
+
+/**
+ * @brief Turn several leds on or off with a single port write, no intermediate color is shown.
+ *
+ * @param ledMask Leds to update (LED_*_STATE_MSK).
+ * @param onMask Leds among ledMask to turn on, the others in ledMask are turned off.
+ */
+void app_led_set(uint32_t ledMask, uint32_t onMask);
 uint32_t app_led_get_status(void);
 
 
@@ -10,10 +10,40 @@
  */
 #include "app_main.h"
 
+/*******************************************************************************
+ * Function Prototypes
+ ******************************************************************************/
+static uint8_t app_cmd_reply(const char *msg);
+static uint8_t app_cmd_led_status(const app_cmd_args_t *args);
+static uint8_t app_cmd_help(const app_cmd_args_t *args);
+static uint8_t app_cmd_red_on(const app_cmd_args_t *args);
+static uint8_t app_cmd_red_off(const app_cmd_args_t *args);
+static uint8_t app_cmd_green_on(const app_cmd_args_t *args);
+static uint8_t app_cmd_green_off(const app_cmd_args_t *args);
+static uint8_t app_cmd_blue_on(const app_cmd_args_t *args);
+static uint8_t app_cmd_blue_off(const app_cmd_args_t *args);
+static uint8_t app_cmd_unknown(const app_cmd_args_t *args);
+static uint8_t app_cmd_bad_args(const app_cmd_args_t *args);
+
 /*******************************************************************************
  * Variables
  ******************************************************************************/
-static system_cmd_t systemCmd = IDLE;
+/* Command table: add a command by adding an entry, {name, handler, argument schema} */
+static const app_cmd_t cmdTable[] = {
+    {CMD_GET_LED_STATUS, app_cmd_led_status, ""},
+    {CMD_HELP,           app_cmd_help,       ""},
+    {CMD_RED_ON,         app_cmd_red_on,     ""},
+    {CMD_RED_OFF,        app_cmd_red_off,    ""},
+    {CMD_GREEN_ON,       app_cmd_green_on,   ""},
+    {CMD_GREEN_OFF,      app_cmd_green_off,  ""},
+    {CMD_BLUE_ON,        app_cmd_blue_on,    ""},
+    {CMD_BLUE_OFF,       app_cmd_blue_off,   ""}
+};
+
+/* Replies for lines that do not match the table */
+static const app_cmd_t cmdUnknown = {"", app_cmd_unknown, ""};
+static const app_cmd_t cmdBadArgs = {"", app_cmd_bad_args, ""};
+
 
 /*******************************************************************************
  * Function Definitions
@@ -21,13 +51,40 @@ static system_cmd_t systemCmd = IDLE;
 uint8_t app_main_init(void)
 {
     uint8_t retVal = APP_INIT_OK;
-    if (app_uart_init() != APP_UART_OK)
+
+    /* Priority grouping first, every driver below enables its interrupt with a preemption level */
+    HAL_IRQ_SetPriorityGrouping(HAL_IRQ_PRIO_GROUPING);
+
+    /* System services used by the drivers: time base for the timeouts, eDMA for the DMA UART instances */
+    if (time_init() == 0U)
+    {
+        retVal = APP_INIT_FAIL;
+    }
+    else
+    {
+        HAL_DMA_Init();
+    }
+
+    if ((APP_INIT_FAIL == retVal) || (app_uart_init() != APP_UART_OK) || (app_led_init() != APP_LED_OK))
+    {
+        retVal = APP_INIT_FAIL;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+
+    /* Queue of commands feeding the FSM */
+    app_event_init();
+
+    /* Build the command lookup index */
+    if (app_cmd_init(cmdTable, sizeof(cmdTable) / sizeof(cmdTable[0])) != APP_CMD_OK)
     {
         retVal = APP_INIT_FAIL;
     }
     else
     {
-        app_led_init();
+        /* Do nothing */
     }
 
     /* Start receive command */
@@ -38,133 +95,153 @@ uint8_t app_main_init(void)
 
 void app_event_parser(void)
 {
-    static uint8_t receiveByte = 0;
-    if (APP_UART_OK == app_uart_get_incoming_data(&receiveByte))
+    const uint8_t *line = NULL;
+    uint32_t lineLength = 0;
+    uint8_t parseResult = APP_CMD_OK;
+    const app_cmd_t *cmd = NULL;
+    app_cmd_args_t args;
+    uint8_t queueFull = 0;
+
+    /* Consume every complete line, several commands may be queued per pass */
+    while ((0 == queueFull) && (APP_UART_OK == app_uart_get_line(&line, &lineLength)))
     {
-        if (('\n' == receiveByte))
+        /* Name is hashed and matched in place, arguments parsed against the schema */
+        parseResult = app_cmd_parse(line, lineLength, &cmd, &args);
+
+        if (APP_CMD_NOT_FOUND == parseResult)
+        {
+            cmd = &cmdUnknown;
+        }
+        else if (APP_CMD_OK != parseResult)
         {
-            uint8_t receiveLength = app_uart_get_buffer_size();
-            uint8_t receiveData[receiveLength];
-            app_uart_get_buffer_data(receiveData);
-
-            uint8_t cmdLength = receiveLength - 1;
-            uint8_t cmdData[cmdLength];
-
-            strncpy((char *)cmdData, (const char *)receiveData, cmdLength);
-            cmdData[cmdLength - 1] = '\0';
-
-            if (strcmp((const char *)cmdData, CMD_GET_LED_STATUS) == 0U)
-            {
-                systemCmd = GET_LED_STATUS;
-            }
-            else if (strcmp((const char *)cmdData, CMD_HELP) == 0U)
-            {
-                systemCmd = SHOW_HELP_INFO;
-            }
-            else if (strcmp((const char *)cmdData, CMD_BLUE_ON) == 0U)
-            {
-                systemCmd = TURN_BLUE_ON;
-            }
-            else if (strcmp((const char *)cmdData, CMD_BLUE_OFF) == 0U)
-            {
-                systemCmd = TURN_BLUE_OFF;
-            }
-            else if (strcmp((const char *)cmdData, CMD_GREEN_ON) == 0U)
-            {
-                systemCmd = TURN_GREEN_ON;
-            }
-            else if (strcmp((const char *)cmdData, CMD_GREEN_OFF) == 0U)
-            {
-                systemCmd = TURN_GREEN_OFF;
-            }
-            else if (strcmp((const char *)cmdData, CMD_RED_ON) == 0U)
-            {
-                systemCmd = TURN_RED_ON;
-            }
-            else if (strcmp((const char *)cmdData, CMD_RED_OFF) == 0U)
-            {
-                systemCmd = TURN_RED_OFF;
-            }
-            else
-            {
-                systemCmd = UNKNOWN_CMD;
-            }
-
-            receiveByte = '\0';
+            cmd = &cmdBadArgs;
         }
         else
         {
             /* Do nothing */
         }
+
+        if (app_event_post(cmd, &args) == APP_EVENT_FULL)
+        {
+            /* Keep the line in its slot, it is parsed again on the next pass */
+            queueFull = 1;
+        }
+        else
+        {
+            /* Give the slot back to the receive engine */
+            app_uart_release_line();
+        }
     }
-    else
+}
+
+void app_run_fsm(void)
+{
+    app_event_t *event = NULL;
+    uint32_t budget = APP_FSM_EVENT_BUDGET;
+
+    /* Run a batch of events, bounded so one pass never takes too long */
+    while ((budget > 0) && (APP_EVENT_OK == app_event_peek(&event)))
     {
-        /* Do nothing */
+        if (event->cmd->handler(&event->args) == APP_CMD_RETRY)
+        {
+            /* Keep the event at the head, run again on the next pass */
+            budget = 0;
+        }
+        else
+        {
+            app_event_pop();
+            budget--;
+        }
     }
 }
 
-void app_run_fsm(void)
+/* Queue a reply, retry the command later while the transmit queue is full */
+static uint8_t app_cmd_reply(const char *msg)
+{
+    return (app_uart_send_char(msg) == APP_UART_TX_QUEUE_FULL) ? APP_CMD_RETRY : APP_CMD_DONE;
+}
+
+static uint8_t app_cmd_led_status(const app_cmd_args_t *args)
 {
     uint8_t ledStatus;
     char statusMsg[33];
 
-    switch (systemCmd)
-    {
-    case IDLE:
-        /* Wait for processing event */
-        break;
-    case GET_LED_STATUS:
-        ledStatus = app_led_get_status();
-        memset(statusMsg, 0, strlen(statusMsg));
-        snprintf(statusMsg, sizeof(statusMsg), "STATUS: RED=%d, GREEN=%d, BLUE=%d\r\n",
-                 (ledStatus & LED_RED_STATE_MSK) ? 1 : 0,
-                 (ledStatus & LED_GREEN_STATE_MSK) ? 1 : 0,
-                 (ledStatus & LED_BLUE_STATE_MSK) ? 1 : 0);
-        app_uart_send_char(statusMsg, 100000000);
-
-        systemCmd = IDLE;
-        break;
-    case SHOW_HELP_INFO:
-        app_uart_send_char((char *)"--- LED Control Guidline ---\r\nLED STATUS: Get all LED states\r\nRED/GREEN/BLUE ON/OFF: Control a LED\r\n", 100000);
-
-        systemCmd = IDLE;
-        break;
-    case TURN_BLUE_ON:
-        app_led_control(PIN_LED_BLUE, TURN_ON);
-
-        systemCmd = IDLE;
-        break;
-    case TURN_BLUE_OFF:
-        app_led_control(PIN_LED_BLUE, TURN_OFF);
-
-        systemCmd = IDLE;
-        break;
-    case TURN_RED_ON:
-        app_led_control(PIN_LED_RED, TURN_ON);
-
-        systemCmd = IDLE;
-        break;
-    case TURN_RED_OFF:
-        app_led_control(PIN_LED_RED, TURN_OFF);
-
-        systemCmd = IDLE;
-        break;
-    case TURN_GREEN_ON:
-        app_led_control(PIN_LED_GREEN, TURN_ON);
-
-        systemCmd = IDLE;
-        break;
-    case TURN_GREEN_OFF:
-        app_led_control(PIN_LED_GREEN, TURN_OFF);
-
-        systemCmd = IDLE;
-        break;
-    case UNKNOWN_CMD:
-        app_uart_send_char((char *)"Not recognized as a command, type \"HELP\" for more information\r\n", 1000);
-
-        systemCmd = IDLE;
-        break;
-    default:
-        break;
-    }
+    (void)args;
+
+    ledStatus = app_led_get_status();
+    snprintf(statusMsg, sizeof(statusMsg), "STATUS: RED=%d, GREEN=%d, BLUE=%d\r\n",
+             (ledStatus & LED_RED_STATE_MSK) ? 1 : 0,
+             (ledStatus & LED_GREEN_STATE_MSK) ? 1 : 0,
+             (ledStatus & LED_BLUE_STATE_MSK) ? 1 : 0);
+
+    return app_cmd_reply(statusMsg);
+}
+
+static uint8_t app_cmd_help(const app_cmd_args_t *args)
+{
+    (void)args;
+
+    return app_cmd_reply("--- LED Control Guidline ---\r\nLED STATUS: Get all LED states\r\nRED/GREEN/BLUE ON/OFF: Control a LED\r\n");
+}
+
+static uint8_t app_cmd_red_on(const app_cmd_args_t *args)
+{
+    (void)args;
+
+    app_led_control(PIN_LED_RED, TURN_ON);
+    return APP_CMD_DONE;
+}
+
+static uint8_t app_cmd_red_off(const app_cmd_args_t *args)
+{
+    (void)args;
+
+    app_led_control(PIN_LED_RED, TURN_OFF);
+    return APP_CMD_DONE;
+}
+
+static uint8_t app_cmd_green_on(const app_cmd_args_t *args)
+{
+    (void)args;
+
+    app_led_control(PIN_LED_GREEN, TURN_ON);
+    return APP_CMD_DONE;
+}
+
+static uint8_t app_cmd_green_off(const app_cmd_args_t *args)
+{
+    (void)args;
+
+    app_led_control(PIN_LED_GREEN, TURN_OFF);
+    return APP_CMD_DONE;
+}
+
+static uint8_t app_cmd_blue_on(const app_cmd_args_t *args)
+{
+    (void)args;
+
+    app_led_control(PIN_LED_BLUE, TURN_ON);
+    return APP_CMD_DONE;
+}
+
+static uint8_t app_cmd_blue_off(const app_cmd_args_t *args)
+{
+    (void)args;
+
+    app_led_control(PIN_LED_BLUE, TURN_OFF);
+    return APP_CMD_DONE;
+}
+
+static uint8_t app_cmd_unknown(const app_cmd_args_t *args)
+{
+    (void)args;
+
+    return app_cmd_reply("Not recognized as a command, type \"HELP\" for more information\r\n");
+}
+
+static uint8_t app_cmd_bad_args(const app_cmd_args_t *args)
+{
+    (void)args;
+
+    return app_cmd_reply("Wrong arguments, type \"HELP\" for more information\r\n");
 }
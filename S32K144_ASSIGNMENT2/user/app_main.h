@@ -3,7 +3,8 @@
  * @author benecosta
  * @brief A library provide all function that needed to run the main application, including:
  * - Init all the related peripheral for this application, through other supported app.
- * - Processing data and main program flow using fsm.
+ * - Processing data and main program flow using fsm, commands are looked up in a table-driven registry
+ *   and queued as events, the fsm runs them in batches.
  * @version 0.1
  * @date 2025-10-09
  * 
@@ -17,7 +18,12 @@
 #include "string.h"
 #include <stdio.h>
 #include "app_uart.h"
+#include "hal_dma.h"
+#include "hal_irq.h"
+#include "time_base.h"
 #include "app_led.h"
+#include "app_cmd.h"
+#include "app_event.h"
 
 /*******************************************************************************
  * Definitions
@@ -28,6 +34,9 @@
 
 #define LED_NUM         3
 
+/* Maximum number of events run by one call of app_run_fsm */
+#define APP_FSM_EVENT_BUDGET    4
+
 /* Define command from user */
 #define CMD_RED_ON          (const char *)"RED_ON"
 #define CMD_RED_OFF         (const char *)"RED_OFF"
@@ -38,24 +47,6 @@
 #define CMD_GET_LED_STATUS  (const char *)"LED_STATUS"
 #define CMD_HELP            (const char *)"HELP"
 
-/*******************************************************************************
- * Structures
- ******************************************************************************/
-/* Manage system processing event */
-typedef enum
-{
-    IDLE,
-    GET_LED_STATUS,
-    TURN_RED_ON,
-    TURN_RED_OFF,
-    TURN_GREEN_ON,
-    TURN_GREEN_OFF,
-    TURN_BLUE_ON,
-    TURN_BLUE_OFF,
-    SHOW_HELP_INFO,
-    UNKNOWN_CMD
-} system_cmd_t;
-
 /*******************************************************************************
  * Function Prototypes
  ******************************************************************************/
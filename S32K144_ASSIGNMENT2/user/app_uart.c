@@ -15,26 +15,80 @@
  ******************************************************************************/
 #define USART_BAUDRATE 9600
 
+/* LPUART instance behind Driver_USART1, used for line reception */
+#define APP_UART_INSTANCE HAL_LPUART1
+
+/* FIFO watermarks: refill TX when at most 1 byte is left, interrupt RX at 3 bytes or on idle */
+#define APP_UART_TX_WATERMARK 1
+#define APP_UART_RX_WATERMARK 2
+
+/*
+ * RX idle time: without idle framing a partial FIFO is flushed after 1 idle char so typed
+ * keys reach the line handler at once. With idle framing the idle event closes the line,
+ * so it must be much longer than the gap between keystrokes or machine-sent bytes.
+ */
+#define APP_UART_RX_IDLE      HAL_UART_RX_IDLE_1_CHAR
+#define APP_UART_LINE_IDLE    HAL_UART_RX_IDLE_64_CHARS
+
+/* Compiler barrier: a queued message or line is written before its slot is published */
+#define APP_UART_BARRIER() __asm volatile ("" : : : "memory")
+
 /*******************************************************************************
- * Variables
+ * Structures
  ******************************************************************************/
-/* Define variable manage receiving data from uart */
-static volatile uint8_t receivedData = 0;
-static volatile uint8_t receiveBuffer[BUFFER_SIZE];
-static volatile uint8_t receiveBufferCounter = 0;
+/* A pending message, copied so the caller buffer can be reused right away */
+typedef struct
+{
+	uint8_t data[APP_UART_TX_SLOT_SIZE];
+	uint32_t length;
+} app_uart_tx_slot_t;
+
+/* A received line, assembled in place by the ISR and NUL terminated */
+typedef struct
+{
+	uint8_t data[APP_UART_LINE_MAX_LENGTH + 1];
+	uint32_t length;
+} app_uart_line_slot_t;
 
-/* Define status flag for transmitter and receiver */
-static volatile uint8_t sendDataCompleteFlag = APP_UART_TRANSMIT_IDLE;
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+/* Line queue: head is only written by the ISR, tail only by the parser */
+static app_uart_line_slot_t lineQueue[APP_UART_LINE_SLOT_COUNT];
+static volatile uint32_t lineQueueHead = 0;
+static volatile uint32_t lineQueueTail = 0;
+
+/* Line being assembled in lineQueue[lineQueueHead], only used in the ISR */
+static uint32_t lineLength = 0;
+static uint8_t lineDiscard = 0;
+static volatile uint32_t lineDropCount = 0;
+
+/* Line framing configuration */
+static uint8_t lineDelimiter = '\n';
+static uint32_t lineMaxLength = APP_UART_LINE_MAX_LENGTH;
+static uint8_t lineCloseOnIdle = 0;
+
+/* Define status flag for receiver */
 static volatile uint8_t receiveDataCompleteFlag = APP_UART_RECEIVE_IDLE;
 
+/* Transmit queue: head is only written by the main loop, tail only by the send complete event */
+static app_uart_tx_slot_t txQueue[APP_UART_TX_QUEUE_SIZE];
+static volatile uint32_t txQueueHead = 0;
+static volatile uint32_t txQueueTail = 0;
+static volatile uint8_t txActive = 0;
+
 /* CMSIS Driver manager struct */
-extern ARM_DRIVER_USART Driver_USART0;
-ARM_DRIVER_USART* uart0_drv = &Driver_USART0;
+extern ARM_DRIVER_USART Driver_USART1;
+ARM_DRIVER_USART* uart1_drv = &Driver_USART1;
 
 /*******************************************************************************
  * Function Prototypes
  ******************************************************************************/
 static void app_uart_callback(uint32_t event);
+static void app_uart_start_next(void);
+static void app_uart_rx_byte(uint8_t data);
+static void app_uart_close_line(void);
+static uint8_t app_uart_config_fifo(hal_uart_rx_idle_t rxIdle);
 
 /*******************************************************************************
  * Function Definitions
@@ -48,15 +102,16 @@ uint8_t app_uart_init(void)
 				| ARM_USART_STOP_BITS_1
 				| ARM_USART_MODE_ASYNCHRONOUS;
 
-	if(uart0_drv->Initialize(app_uart_callback) == ARM_DRIVER_OK)
+	if(uart1_drv->Initialize(app_uart_callback) == ARM_DRIVER_OK)
 	{
-		if(uart0_drv->Control(mode, USART_BAUDRATE) != ARM_DRIVER_OK)
+		if(uart1_drv->Control(mode, USART_BAUDRATE) != ARM_DRIVER_OK)
 		{
 			retVal = APP_UART_ERROR;
 		}
 		else
 		{
-			/* Do nothing */
+			/* Move several bytes per interrupt instead of one */
+			retVal = app_uart_config_fifo(APP_UART_RX_IDLE);
 		}
 
 	}
@@ -69,40 +124,127 @@ uint8_t app_uart_init(void)
 
 }
 
-uint8_t app_uart_send_char(char* data, uint32_t timeout)
+/**
+ * @brief Enables the LPUART FIFOs with the application watermarks and the given RX idle time.
+ */
+static uint8_t app_uart_config_fifo(hal_uart_rx_idle_t rxIdle)
 {
 	uint8_t retVal = APP_UART_OK;
-	uint32_t timeoutCounter = 0;
-	uint8_t length = strlen((const char*)data);
+	hal_uart_fifo_config_t fifoConfig = {
+			.txWatermark = APP_UART_TX_WATERMARK,
+			.rxWatermark = APP_UART_RX_WATERMARK,
+			.rxIdle = rxIdle
+	};
 
-	uart0_drv->Send((uint8_t*)data, length);
-	sendDataCompleteFlag = APP_UART_TRANSMIT_INPROGRESS;
+	if(HAL_UART_ConfigureFifo(APP_UART_INSTANCE, &fifoConfig) == 0)
+	{
+		retVal = APP_UART_ERROR;
+	}
+	else
+	{
+		/* Do nothing */
+	}
+
+	return retVal;
+}
 
-	/* Define check with time get tick later... */
-	while((timeoutCounter < timeout) && (APP_UART_TRANSMIT_COMPLETE == sendDataCompleteFlag))
+uint8_t app_uart_send(const uint8_t* data, uint32_t length)
+{
+	uint8_t retVal = APP_UART_OK;
+	uint32_t head = txQueueHead;
+	app_uart_tx_slot_t* slot = NULL;
+
+	if((NULL == data) || (0 == length) || (length > APP_UART_TX_SLOT_SIZE))
 	{
-		delay(1000*1000);
-		timeoutCounter++;
+		retVal = APP_UART_SEND_FAIL;
+	}
+	else if((head - txQueueTail) >= APP_UART_TX_QUEUE_SIZE)
+	{
+		/* Back-pressure: caller keeps the message and retries later */
+		retVal = APP_UART_TX_QUEUE_FULL;
+	}
+	else
+	{
+		slot = &txQueue[head % APP_UART_TX_QUEUE_SIZE];
+		memcpy(slot->data, data, length);
+		slot->length = length;
+
+		APP_UART_BARRIER();
+		txQueueHead = head + 1;
+
+		/* Nothing in flight, the send complete event can not race with us */
+		if(0 == txActive)
+		{
+			txActive = 1;
+			app_uart_start_next();
+		}
+		else
+		{
+			/* Do nothing, chained by the send complete event */
+		}
 	}
 
-	if(APP_UART_TRANSMIT_COMPLETE == sendDataCompleteFlag)
+	return retVal;
+}
+
+uint8_t app_uart_send_char(const char* data)
+{
+	uint8_t retVal = APP_UART_SEND_FAIL;
+
+	if(NULL != data)
 	{
-		sendDataCompleteFlag = APP_UART_TRANSMIT_IDLE;
+		retVal = app_uart_send((const uint8_t*)data, strlen(data));
 	}
 	else
 	{
-		sendDataCompleteFlag = APP_UART_TRANSMIT_IDLE;
-		retVal = APP_UART_SEND_FAIL;
+		/* Do nothing */
 	}
 
 	return retVal;
 }
 
-uint8_t app_uart_receive_char(char* data, uint32_t length, uint32_t timeout)
+uint32_t app_uart_get_tx_pending(void)
 {
-	uint8_t retVal = APP_UART_OK;
-	uint32_t timeoutCounter = 0;
+	return txQueueHead - txQueueTail;
+}
+
+/**
+ * @brief Starts the oldest queued message, called with txActive set.
+ * Messages the driver refuses are dropped so the queue never stalls.
+ */
+static void app_uart_start_next(void)
+{
+	uint8_t started = 0;
+	app_uart_tx_slot_t* slot = NULL;
+
+	while((0 == started) && (txQueueTail != txQueueHead))
+	{
+		slot = &txQueue[txQueueTail % APP_UART_TX_QUEUE_SIZE];
+
+		if(uart1_drv->Send(slot->data, slot->length) == ARM_DRIVER_OK)
+		{
+			started = 1;
+		}
+		else
+		{
+			txQueueTail++;
+		}
+	}
 
+	if(0 == started)
+	{
+		txActive = 0;
+	}
+	else
+	{
+		/* Do nothing */
+	}
+}
+
+uint8_t app_uart_receive_char(char* data, uint32_t length, uint32_t timeoutMs)
+{
+	uint8_t retVal = APP_UART_OK;
+	uint64_t deadline = 0;
 
 	if(length > BUFFER_SIZE)
 	{
@@ -110,12 +252,12 @@ uint8_t app_uart_receive_char(char* data, uint32_t length, uint32_t timeout)
 	}
 	else
 	{
-		uart0_drv->Receive((uint8_t*)data, length);
+		deadline = time_now_us() + ((uint64_t)timeoutMs * 1000U);
+		uart1_drv->Receive((uint8_t*)data, length);
 
-		/* Define check with time get tick later... */
-		while((timeoutCounter < timeout) && (APP_UART_RECEIVE_DATA == receiveDataCompleteFlag))
+		while((time_now_us() < deadline) && (APP_UART_RECEIVE_DATA != receiveDataCompleteFlag))
 		{
-			timeoutCounter++;
+			/* Do nothing, wait for the receive complete event */
 		}
 
 		if(APP_UART_RECEIVE_DATA == receiveDataCompleteFlag)
@@ -132,70 +274,184 @@ uint8_t app_uart_receive_char(char* data, uint32_t length, uint32_t timeout)
 	return retVal;
 }
 
-void app_uart_receive_non_blocking(void)
+uint8_t app_uart_line_config(uint8_t delimiter, uint32_t maxLength, uint8_t closeOnIdle)
 {
-	uart0_drv->Receive((void*)&receivedData, 1);
+	uint8_t retVal = APP_UART_OK;
+
+	if((0 == maxLength) || (maxLength > APP_UART_LINE_MAX_LENGTH))
+	{
+		retVal = APP_UART_ERROR;
+	}
+	else
+	{
+		/* Only called before app_uart_receive_non_blocking */
+		lineDelimiter = delimiter;
+		lineMaxLength = maxLength;
+		lineCloseOnIdle = closeOnIdle;
+
+		/* Idle framing needs a long idle time, or every keystroke becomes a line */
+		retVal = app_uart_config_fifo((0 != closeOnIdle) ? APP_UART_LINE_IDLE : APP_UART_RX_IDLE);
+	}
+
+	return retVal;
 }
 
+void app_uart_receive_non_blocking(void)
+{
+	/* Lines are assembled byte by byte in the ISR, no re-arm per byte */
+	HAL_UART_StartRxHandler(APP_UART_INSTANCE, app_uart_rx_byte);
+}
 
-uint8_t app_uart_get_incoming_data(uint8_t* data)
+uint8_t app_uart_get_line(const uint8_t** line, uint32_t* length)
 {
-	uint8_t retVal = APP_UART_OK;
-	if(NULL == data)
+	uint8_t retVal = APP_UART_RECEIVE_IDLE;
+	uint32_t tail = lineQueueTail;
+
+	if((NULL == line) || (NULL == length))
 	{
 		retVal = APP_UART_ERROR;
 	}
+	else if(lineQueueHead != tail)
+	{
+		/* Hand out the slot itself, it stays owned by the parser until released */
+		*line = lineQueue[tail % APP_UART_LINE_SLOT_COUNT].data;
+		*length = lineQueue[tail % APP_UART_LINE_SLOT_COUNT].length;
+		retVal = APP_UART_OK;
+	}
 	else
 	{
-		if(APP_UART_RECEIVE_DATA == receiveDataCompleteFlag)
+		/* Do nothing */
+	}
+
+	return retVal;
+}
+
+void app_uart_release_line(void)
+{
+	if(lineQueueHead != lineQueueTail)
+	{
+		APP_UART_BARRIER();
+		lineQueueTail++;
+	}
+	else
+	{
+		/* Do nothing */
+	}
+}
+
+uint32_t app_uart_get_line_drops(void)
+{
+	return lineDropCount;
+}
+
+/**
+ * @brief Appends a received byte to the current line, runs in the LPUART ISR.
+ * Lines longer than the maximum length, or arriving while every slot is full,
+ * are discarded up to the next delimiter.
+ */
+static void app_uart_rx_byte(uint8_t data)
+{
+	if(data == lineDelimiter)
+	{
+		app_uart_close_line();
+	}
+	else if(0 != lineDiscard)
+	{
+		/* Do nothing, wait for the end of the line */
+	}
+	else if((lineLength >= lineMaxLength)
+			|| ((lineQueueHead - lineQueueTail) >= APP_UART_LINE_SLOT_COUNT))
+	{
+		lineDiscard = 1;
+		lineDropCount++;
+	}
+	else
+	{
+		lineQueue[lineQueueHead % APP_UART_LINE_SLOT_COUNT].data[lineLength] = data;
+		lineLength++;
+	}
+}
+
+/**
+ * @brief Publishes the current line to the parser, runs in the LPUART ISR.
+ * Called on the delimiter or when the line goes idle.
+ */
+static void app_uart_close_line(void)
+{
+	app_uart_line_slot_t* slot = &lineQueue[lineQueueHead % APP_UART_LINE_SLOT_COUNT];
+
+	if((0 == lineDiscard) && (lineLength > 0))
+	{
+		/* Drop the carriage return of a CRLF terminal */
+		if('\r' == slot->data[lineLength - 1])
 		{
-			*data = receivedData;
-			receiveDataCompleteFlag = APP_UART_RECEIVE_IDLE;
+			lineLength--;
 		}
 		else
 		{
 			/* Do nothing */
 		}
 
-	}
+		if(lineLength > 0)
+		{
+			slot->data[lineLength] = '\0';
+			slot->length = lineLength;
 
-	return retVal;
-}
+			APP_UART_BARRIER();
+			lineQueueHead++;
+		}
+		else
+		{
+			/* Do nothing */
+		}
+	}
+	else
+	{
+		/* Do nothing */
+	}
 
-uint8_t app_uart_get_buffer_size(void)
-{
-	return receiveBufferCounter;
+	lineLength = 0;
+	lineDiscard = 0;
 }
 
 
 void app_uart_callback(uint32_t event)
 {
-	if((event & ARM_USART_EVENT_RECEIVE_COMPLETE) != 0U)
+	if((event & ARM_USART_EVENT_RX_TIMEOUT) != 0U)
 	{
-		receiveBuffer[receiveBufferCounter] = receivedData;
-		receiveDataCompleteFlag = APP_UART_RECEIVE_DATA;
-		receiveBufferCounter++;
-
-		if(receiveBufferCounter >= BUFFER_SIZE)
+		/* Line went idle: close the frame even without delimiter */
+		if(0 != lineCloseOnIdle)
 		{
-			receiveBufferCounter = 0;
+			app_uart_close_line();
+		}
+		else
+		{
+			/* Do nothing */
 		}
-
-		app_uart_receive_non_blocking();
 	}
-	else if((event & ARM_USART_EVENT_SEND_COMPLETE) != 0U)
+	else
 	{
-		sendDataCompleteFlag = APP_UART_TRANSMIT_COMPLETE;
+		/* Do nothing */
+	}
 
+	if((event & ARM_USART_EVENT_RECEIVE_COMPLETE) != 0U)
+	{
+		receiveDataCompleteFlag = APP_UART_RECEIVE_DATA;
 	}
 	else
 	{
 		/* Do nothing */
 	}
-}
 
-void app_uart_get_buffer_data(uint8_t* receiveData)
-{
-	strcpy((char*)receiveData, (const char*)receiveBuffer);
-	receiveBufferCounter = 0;
+	/* Checked on its own, it may come in the same interrupt as a receive event */
+	if((event & (ARM_USART_EVENT_SEND_COMPLETE | HAL_UART_EVENT_TX_DMA_ERROR)) != 0U)
+	{
+		/* Release the slot just sent, or dropped on a DMA error, and chain the next message */
+		txQueueTail++;
+		app_uart_start_next();
+	}
+	else
+	{
+		/* Do nothing */
+	}
 }
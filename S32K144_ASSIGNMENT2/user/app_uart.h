@@ -4,7 +4,8 @@
  * @brief A library provide services about send, receive and manage data through LPUART, including:
  * - Init related peripheral through CMSIS Driver.
  * - Create API for send and receive in both blocking and non-blocking style.
- * - Manage data through private buffer.
+ * - Queue messages to send, the send complete event starts the next one.
+ * - Assemble received lines in the ISR and queue them for the parser without copies.
  * @version 0.1
  * @date 2025-10-09
  * 
@@ -17,6 +18,8 @@
 #include "S32K144.h"
 #include "string.h"
 #include "Driver_USART.h"
+#include "hal_uart.h"
+#include "time_base.h"
 
 /*******************************************************************************
  * Definitions
@@ -24,6 +27,14 @@
 /* Define receive buffer size */
 #define BUFFER_SIZE 64
 
+/* Define line reception: number of complete lines queued and maximum line length */
+#define APP_UART_LINE_SLOT_COUNT    4
+#define APP_UART_LINE_MAX_LENGTH    BUFFER_SIZE
+
+/* Define transmit queue: number of pending messages and maximum message length */
+#define APP_UART_TX_QUEUE_SIZE      4
+#define APP_UART_TX_SLOT_SIZE       128
+
 /* Define uart application error code */
 #define APP_UART_ERROR                     0
 #define APP_UART_OK                        1
@@ -35,19 +46,26 @@
 #define APP_UART_TRANSMIT_COMPLETE         7
 #define APP_UART_TRANSMIT_INPROGRESS       8
 #define APP_UART_TRANSMIT_IDLE             9
+#define APP_UART_TX_QUEUE_FULL             10
 
 
 /*******************************************************************************
  * Function Prototypes
  ******************************************************************************/
 uint8_t app_uart_init(void);
-uint8_t app_uart_send_char(char* data, uint32_t timeout);
-uint8_t app_uart_receive_char(char* data, uint32_t length, uint32_t timeout);
-uint8_t app_uart_get_buffer_size(void);
-/* reset buffer counter, return size */
-void app_uart_get_buffer_data(uint8_t* receiveData);
+/* Queue a message and return at once, APP_UART_TX_QUEUE_FULL when no slot is free */
+uint8_t app_uart_send(const uint8_t* data, uint32_t length);
+uint8_t app_uart_send_char(const char* data);
+uint32_t app_uart_get_tx_pending(void);
+/* Receive a block, give up after timeoutMs milliseconds of the system time base */
+uint8_t app_uart_receive_char(char* data, uint32_t length, uint32_t timeoutMs);
+/* Set line delimiter, maximum length and idle closing (off by default), before reception is started */
+uint8_t app_uart_line_config(uint8_t delimiter, uint32_t maxLength, uint8_t closeOnIdle);
 void app_uart_receive_non_blocking(void);
-uint8_t app_uart_get_incoming_data(uint8_t* data);
+/* Get the oldest complete line (NUL terminated, no delimiter), valid until released */
+uint8_t app_uart_get_line(const uint8_t** line, uint32_t* length);
+void app_uart_release_line(void);
+uint32_t app_uart_get_line_drops(void);
 
 
 #endif /* APP_UART_H_ */
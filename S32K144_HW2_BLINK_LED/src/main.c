@@ -7,7 +7,8 @@
  */
 
 #include "S32K144.h"
-#include "my_nvic.h"
+#include "hal_irq.h"
+#include "sleep.h"
 #include <stdio.h>
 
 /* =================================================================================================================
@@ -30,10 +31,6 @@
 /* =================================================================================================================
  * Defines and Macros
  * =================================================================================================================*/
-#define CPU_CLOCK_FREQ      8000000UL
-#define CYCLES_PER_MS       (CPU_CLOCK_FREQ / 1000UL)
-
-
 #define GPIO_PIN_INPUT      0
 #define GPIO_PIN_OUTPUT     1
 
@@ -45,9 +42,6 @@
  * Function Prototypes
  * =================================================================================================================*/
 
-// --- Hàm hệ thống ---
-void System_DelayMs(uint32_t delay_in_ms);
-
 // --- Các hàm liên quan đến GPIO ---
 void GPIO_EnablePortClock(uint8_t port_index);
 void GPIO_InitPin(PORT_Type* port, GPIO_Type* gpio_port, uint8_t pin_number, uint8_t direction);
@@ -67,26 +61,38 @@ void App_Init_LEDs(void);
  * Main Function
  * =================================================================================================================*/
 int main(void) {
+    // Chia nhóm ưu tiên trước khi bật ngắt đầu tiên: mọi bit ưu tiên đều là bit preempt
+    HAL_IRQ_SetPriorityGrouping(HAL_IRQ_PRIO_GROUPING);
     // Khởi tạo các chân GPIO được sử dụng làm đèn LED
     App_Init_LEDs();
+    // Khởi tạo sleep trước TIM_Init vì sleep chọn nguồn clock cho LPIT (SIRCDIV2 8MHz)
+    if (0 == sleep_init(SLEEP_MODE_WAIT))
+    {
+        // LPIT chưa có clock hợp lệ, không được chạm vào LPIT trong TIM_Init: dừng tại đây
+        while(1)
+        {
+        }
+    }
     TIM_Init();
 
-    // Vòng lặp vô tận của chương trình
+    // Vòng lặp vô tận của chương trình, CPU ngủ giữa các ngắt thay vì chạy vòng lặp rỗng
     while(1)
     {
+        sleep_ms(1000);
+
 //    	// Đảo trạng thái LED đỏ (PTD0) và chờ 3 giây
 //		GPIO_SetPin(IP_PTD, RED_LED_PIN);
-//		System_DelayMs(3000);
+//		sleep_ms(3000);
 //		GPIO_ClearPin(IP_PTD, RED_LED_PIN);
 //
 //		// Đảo trạng thái LED xanh lá (PTD15) và chờ 3 giây
 //		GPIO_SetPin(IP_PTD, GREEN_LED_PIN);
-//		System_DelayMs(3000);
+//		sleep_ms(3000);
 //		GPIO_ClearPin(IP_PTD, GREEN_LED_PIN);
 //
 //        // Đảo trạng thái LED xanh dương (PTD16) và chờ 3 giây
 //        GPIO_SetPin(IP_PTD, BLUE_LED_PIN);
-//        System_DelayMs(3000);
+//        sleep_ms(3000);
 //        GPIO_ClearPin(IP_PTD, BLUE_LED_PIN);
     }
 
@@ -115,28 +121,6 @@ void App_Init_LEDs(void)
     GPIO_ClearPin(IP_PTD, BLUE_LED_PIN);
 }
 
-/* =================================================================================================================
- * System Functions
- * =================================================================================================================*/
-/**
- * @brief Tạo một khoảng trễ theo mili giây (delay blocking).
- * @note  Đây là hàm delay bằng phần mềm, độ chính xác không cao và sẽ bị ảnh hưởng
- * bởi các ngắt (interrupts). `volatile` được dùng để ngăn trình biên dịch
- * tối ưu hóa (xóa bỏ) vòng lặp for.
- * @param[in] delay_in_ms Thời gian cần trễ tính bằng mili giây.
- */
-void System_DelayMs(uint32_t delay_in_ms)
-{
-    volatile uint32_t loop_count;
-    while(delay_in_ms--)
-    {
-        for(loop_count = 0; loop_count < CYCLES_PER_MS; loop_count++)
-        {
-            __asm("nop");
-        }
-    }
-}
-
 /* =================================================================================================================
  * GPIO Driver Functions
  * =================================================================================================================*/
@@ -214,10 +198,8 @@ void GPIO_EnablePortClock(uint8_t port_index)
 
 void TIM_Init()
 {
-	IP_PCC->PCCn[PCC_LPIT_INDEX] |= PCC_PCCn_CGC_MASK;
-    // 1. Bật clock cho module và thực hiện reset
-    IP_LPIT0->MCR |= LPIT_MCR_SW_RST_MASK;   // Reset module
-    IP_LPIT0->MCR &= ~LPIT_MCR_SW_RST_MASK;  // Xóa bit reset
+    // 1. Clock (SIRCDIV2 8MHz) đã được cấp trong sleep_init(). Không reset module
+    // vì kênh 1-3 đang được module sleep sử dụng.
     IP_LPIT0->MCR |= LPIT_MCR_M_CEN_MASK;   // Bật clock cho module
 
     // 2. Cấu hình chế độ cho Kênh 0 TRƯỚC KHI bật timer
@@ -225,14 +207,14 @@ void TIM_Init()
     IP_LPIT0->TMR[0].TCTRL = 0; // Reset thanh ghi về 0, đảm bảo T_EN=0
 
     // 3. Đặt giá trị đếm cho timer
-    // Ví dụ cho 1ms với clock 8MHz
+    // 1ms với clock SIRCDIV2 8MHz
     IP_LPIT0->TMR[0].TVAL = 8000 - 1;
 
     // 4. Bật ngắt trong module LPIT
     IP_LPIT0->MIER |= LPIT_MIER_TIE0_MASK;
 
     // 5. Bật ngắt trong bộ điều khiển ngắt của CPU (NVIC)
-    NVIC->ISER[LPIT0_Ch0_IRQn / 32] = (1 << (LPIT0_Ch0_IRQn % 32));
+    HAL_IRQ_Enable(LPIT0_Ch0_IRQn);
 
     // 6. Bật timer Kênh 0 sau khi đã hoàn tất cấu hình
     IP_LPIT0->TMR[0].TCTRL |= LPIT_SETTEN_SET_T_EN_0_MASK; // Dùng đúng mask T_EN cho TCTRL
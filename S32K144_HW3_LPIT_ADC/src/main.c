@@ -8,8 +8,11 @@
  */
 
 #include "S32K144.h"
+#include "hal_irq.h"
 #include "software_timer.h"
+#include "scheduler.h"
 #include "adc.h"
+#include "sig_cond.h"
 
 /*==================================================================================================
 * ENUM
@@ -24,9 +27,17 @@ typedef enum {
 /*==================================================================================================
 * GLOBAL VARIABLES
 ==================================================================================================*/
-uint32_t pot_value_ms = 0;
+volatile uint32_t pot_value_ms = 0;
 App_State_t appState = CONTROL_NONE;
 
+/**
+ * @brief Ngưỡng (mV) giữa các trạng thái LED, băng i tương ứng với trạng thái App_State_t thứ i.
+ */
+static const uint32_t ledThresholdsMv[CONTROL_RED] = { 1250U, 2500U, 3750U };
+
+SIG_Classifier_t ledClassifier;
+SIG_Iir_t potFilter;
+
 /*==================================================================================================
 * MACROS DEFINE
 ==================================================================================================*/
@@ -43,6 +54,7 @@ App_State_t appState = CONTROL_NONE;
 #define RED_LED_PIN             15U
 #define GREEN_LED_PIN           16U
 #define POT_PIN                 14U
+#define POT_ADC_CHANNEL         12U
 
 #define BLUE_LED_PORT           IP_PORTD
 #define RED_LED_PORT            IP_PORTD
@@ -53,6 +65,31 @@ App_State_t appState = CONTROL_NONE;
 #define RED_LED_GPIO            IP_PTD
 #define GREEN_LED_GPIO          IP_PTD
 
+/**
+ * @brief Ba LED cùng nằm trên PTD nên có thể cập nhật bằng một lần ghi.
+ */
+#define RGB_LED_GPIO            IP_PTD
+#define RGB_LED_MASK            ((1UL << BLUE_LED_PIN) | (1UL << RED_LED_PIN) | (1UL << GREEN_LED_PIN))
+
+/**
+ * @brief Chu kỳ, độ lệch và mức ưu tiên của các task.
+ * @note Hai task cùng đến hạn, task đọc ADC ưu tiên cao hơn nên LED luôn
+ * được cập nhật theo mẫu mới nhất.
+ */
+#define ADC_TASK_PERIOD_MS      100U
+#define ADC_TASK_OFFSET_MS      100U
+#define ADC_TASK_PRIORITY       0U
+
+#define LED_TASK_PERIOD_MS      100U
+#define LED_TASK_OFFSET_MS      100U
+#define LED_TASK_PRIORITY       1U
+
+/**
+ * @brief Độ trễ (mV) ở mỗi ngưỡng và hệ số lọc IIR của biến trở.
+ */
+#define LED_HYSTERESIS_MV       50U
+#define POT_FILTER_SHIFT        2U
+
 /*==================================================================================================
 * FUNCTION PROTOTYPES
 ==================================================================================================*/
@@ -91,11 +128,26 @@ void GPIO_SetPin(GPIO_Type* gpio_port, uint8_t pin_number);
  */
 void GPIO_ClearPin(GPIO_Type* gpio_port, uint8_t pin_number);
 
+/**
+ * @brief Ghi nhiều chân của cùng một port bằng một lần ghi PDOR.
+ */
+void GPIO_WritePort(GPIO_Type* gpio_port, uint32_t mask, uint32_t value);
+
 /**
  * @brief Chương trình ứng dụng của bài tập 3.
  */
 void App_ControlLedADC(void);
 
+/**
+ * @brief Task đọc giá trị biến trở qua ADC.
+ */
+void Task_SampleADC(void);
+
+/**
+ * @brief Nhận kết quả ADC của biến trở, gọi trong ngắt ADC0.
+ */
+void App_OnPotSample(uint8_t channel, uint16_t value);
+
 /**
  * @brief Cấu hình clock hệ thống để chạy từ SPLL với thạch anh 8MHz.
  * @note Các tần số clock cuối cùng:
@@ -121,6 +173,13 @@ void GPIO_ClearPin(GPIO_Type* gpio_port, uint8_t pin_number)
 
 }
 
+void GPIO_WritePort(GPIO_Type* gpio_port, uint32_t mask, uint32_t value)
+{
+    /* Các chân trong mask đổi trạng thái cùng lúc, không có trạng thái trung gian */
+    gpio_port->PDOR = (gpio_port->PDOR & ~mask) | (value & mask);
+
+}
+
 void GPIO_TogglePin(GPIO_Type* gpio_port, uint8_t pin_number)
 {
     gpio_port->PTOR = (1UL << pin_number);
@@ -215,55 +274,26 @@ void Clock_Init_System_SPLL(void)
 
 void App_ControlLedADC(void)
 {
-    if (pot_value_ms >= 0 && pot_value_ms < 1250)
-    {
-        appState = CONTROL_NONE;
-
-    }
-    else if (pot_value_ms >= 1250 && pot_value_ms < 2500)
-    {
-        appState = CONTROL_BLUE;
-
-    }
-    else if (pot_value_ms >= 2500 && pot_value_ms < 3750)
-    {
-        appState = CONTROL_GREEN;
-
-    }
-    else if (pot_value_ms >= 3750 && pot_value_ms <= 5000)
-    {
-        appState = CONTROL_RED;
-
-    }
-    else
-    {
-        /* Do nothing */
-    }
+    /* Có độ trễ ở ngưỡng nên LED không nhấp nháy khi biến trở nằm sát ngưỡng */
+    appState = (App_State_t)SIG_Classify(&ledClassifier, pot_value_ms);
 
+    /* LED tích cực mức thấp: LED được bật là chân bị kéo xuống, ba chân đổi cùng lúc */
     switch (appState)
     {
     case CONTROL_NONE:
-        GPIO_SetPin(BLUE_LED_GPIO, BLUE_LED_PIN);
-        GPIO_SetPin(GREEN_LED_GPIO, GREEN_LED_PIN);
-        GPIO_SetPin(RED_LED_GPIO, RED_LED_PIN);
+        GPIO_WritePort(RGB_LED_GPIO, RGB_LED_MASK, RGB_LED_MASK);
 
         break;
     case CONTROL_BLUE:
-        GPIO_ClearPin(BLUE_LED_GPIO, BLUE_LED_PIN);
-        GPIO_SetPin(GREEN_LED_GPIO, GREEN_LED_PIN);
-        GPIO_SetPin(RED_LED_GPIO, RED_LED_PIN);
+        GPIO_WritePort(RGB_LED_GPIO, RGB_LED_MASK, RGB_LED_MASK & ~(1UL << BLUE_LED_PIN));
 
         break;
     case CONTROL_GREEN:
-        GPIO_SetPin(BLUE_LED_GPIO, BLUE_LED_PIN);
-        GPIO_ClearPin(GREEN_LED_GPIO, GREEN_LED_PIN);
-        GPIO_SetPin(RED_LED_GPIO, RED_LED_PIN);
+        GPIO_WritePort(RGB_LED_GPIO, RGB_LED_MASK, RGB_LED_MASK & ~(1UL << GREEN_LED_PIN));
 
         break;
     case CONTROL_RED:
-        GPIO_SetPin(BLUE_LED_GPIO, BLUE_LED_PIN);
-        GPIO_SetPin(GREEN_LED_GPIO, GREEN_LED_PIN);
-        GPIO_ClearPin(RED_LED_GPIO, RED_LED_PIN);
+        GPIO_WritePort(RGB_LED_GPIO, RGB_LED_MASK, RGB_LED_MASK & ~(1UL << RED_LED_PIN));
 
         break;
     default:
@@ -272,8 +302,28 @@ void App_ControlLedADC(void)
 
 }
 
+void App_OnPotSample(uint8_t channel, uint16_t value)
+{
+    /* Chỉ có một kênh biến trở nên không cần kiểm tra kênh */
+    (void)channel;
+
+    pot_value_ms = SIG_IirUpdate(&potFilter, (uint16_t)ADC_ToMillivolts(value));
+
+}
+
+void Task_SampleADC(void)
+{
+    /* Không chờ kết quả, App_OnPotSample cập nhật giá trị khi chuyển đổi xong.
+     * Nếu lần trước chưa xong thì bỏ qua lượt này và giữ giá trị cũ. */
+    (void)ADC_StartConversion(POT_ADC_CHANNEL, App_OnPotSample);
+
+}
+
 int main(void) {
-    uint16_t adc_value = 0;
+    uint8_t adc_status = ADC_CAL_PENDING;
+
+    /* Chia nhóm ưu tiên trước khi bật ngắt đầu tiên: mọi bit ưu tiên đều là bit preempt */
+    HAL_IRQ_SetPriorityGrouping(HAL_IRQ_PRIO_GROUPING);
 
     Clock_Init_System_SPLL();
 
@@ -285,32 +335,39 @@ int main(void) {
     GPIO_InitPin(GREEN_LED_PORT, GREEN_LED_GPIO, GREEN_LED_PIN,  GPIO_PIN_OUTPUT);
     GPIO_SetPin(GREEN_LED_GPIO, GREEN_LED_PIN);
 
-    if (ADC_INIT_FAIL == ADC_Init())
-    {
-        while(1);
-    }
+    /* Mốc thời gian dùng cho timeout của ADC và cho software timer */
+    time_init();
+
+    /* Biến trở thay đổi chậm nên chọn profile ít nhiễu nhất, profile được áp dụng
+     * khi hiệu chuẩn xong. ADC hiệu chuẩn trong lúc các module khác được khởi tạo. */
+    (void)ADC_SetProfile(&ADC_ProfilePrecise);
+    (void)ADC_StartCalibration();
 
     GPIO_EnablePortClock(PCC_PORTC_INDEX);
     GPIO_InitPinAnalog(POT_PORT, POT_PIN);
 
     TIM_Init();
-    TIM_SetTime(0, 100);
-    TIM_SetTime(1, 100);
+
+    (void)SIG_IirInit(&potFilter, POT_FILTER_SHIFT);
+    (void)SIG_ClassifierInit(&ledClassifier, ledThresholdsMv, CONTROL_RED + 1, LED_HYSTERESIS_MV);
+
+    SCH_Init();
+    SCH_AddTask(Task_SampleADC, ADC_TASK_PERIOD_MS, ADC_TASK_OFFSET_MS, ADC_TASK_PRIORITY);
+    SCH_AddTask(App_ControlLedADC, LED_TASK_PERIOD_MS, LED_TASK_OFFSET_MS, LED_TASK_PRIORITY);
+
+    while (ADC_CAL_PENDING == adc_status)
+    {
+        adc_status = ADC_PollCalibration();
+    }
+
+    if (ADC_SUCCESS != adc_status)
+    {
+        while(1);
+    }
 
     while(1)
     {
-        if (TIM_IsFlag(0))
-        {
-            adc_value = ADC_Read_Channel(12);
-            pot_value_ms = (uint32_t)(((adc_value * 5.0f) / 255.0f) * 1000.0f);
-            TIM_SetTime(0, 100);
-        }
-
-        if(TIM_IsFlag(1))
-        {
-            App_ControlLedADC();
-            TIM_SetTime(1, 100);
-        }
+        SCH_Dispatch();
 
     }
 
@@ -0,0 +1,337 @@
+/**
+ * @file bench_sig_cond.c
+ * @brief Benchmark và kiểm tra trên máy host của sig_cond: đổi ADC sang mV bằng Q16,
+ * bộ lọc trung bình trượt, bộ lọc IIR và bộ phân loại băng có trễ.
+ * @details Kết quả số nguyên được so với phép tính chính xác (double) hoặc cách tính
+ * trực tiếp. Thời gian mỗi mẫu được so với đường xử lý cũ (float và chuỗi so sánh khoảng).
+ * Thời gian đo trên host chỉ dùng để so sánh, không phải số chu kỳ trên chip (Cortex-M4
+ * không có phép tính float double, và float đơn tốn nhiều chu kỳ hơn phép nhân số nguyên).
+ *
+ * @author Nguyen Vuong Trung Nam
+ * @date Oct 17, 2026
+ */
+
+#include "test_common.h"
+#include "sig_cond.h"
+#include "adc.h"
+
+/* Số mẫu đo cho mỗi phép xử lý */
+#define BENCH_SAMPLES           (1UL << 22)
+
+/* Cấu hình của main.c */
+#define BENCH_HYSTERESIS_MV     50U
+#define BENCH_IIR_SHIFT         2U
+#define BENCH_BANDS             4U
+
+static const uint32_t s_thresholdsMv[BENCH_BANDS - 1U] = { 1250U, 2500U, 3750U };
+
+/* Mẫu ADC 8-bit giả lập: dốc chậm cộng nhiễu, dùng chung cho mọi phép đo */
+static uint16_t s_samples[BENCH_SAMPLES];
+
+/* Giữ kết quả để vòng lặp không bị trình biên dịch bỏ đi */
+static volatile uint32_t s_sink = 0;
+
+static uint32_t s_seed = 12345U;
+
+static uint32_t bench_random(void)
+{
+    s_seed = (s_seed * 1103515245U) + 12345U;
+
+    return s_seed >> 16;
+}
+
+/**
+ * @brief Đường xử lý cũ: đổi sang mV bằng float rồi phân loại bằng chuỗi so sánh khoảng.
+ */
+static uint32_t bench_legacy_path(uint16_t adc_value)
+{
+    uint32_t pot_value_ms = (uint32_t)(((adc_value * 5.0f) / 255.0f) * 1000.0f);
+    uint32_t state = 0;
+
+    if (pot_value_ms < 1250)
+    {
+        state = 0;
+    }
+    else if (pot_value_ms < 2500)
+    {
+        state = 1;
+    }
+    else if (pot_value_ms < 3750)
+    {
+        state = 2;
+    }
+    else
+    {
+        state = 3;
+    }
+
+    return state;
+}
+
+/**
+ * @brief Q16 khác giá trị chính xác (làm tròn) tối đa 1 mV ở mọi độ phân giải của adc.c.
+ */
+static void bench_check_q16(void)
+{
+    static const uint32_t full_scales[] = { 255U, 1023U, 4095U, 4095U << ADC_MAX_OVERSAMPLE_BITS };
+    uint32_t scale = 0;
+    uint32_t exact = 0;
+    uint32_t mv = 0;
+
+    for (uint32_t i = 0; i < (sizeof(full_scales) / sizeof(full_scales[0])); i++)
+    {
+        scale = SIG_Q16(ADC_VREF_MV, full_scales[i]);
+
+        for (uint32_t raw = 0; raw <= full_scales[i]; raw++)
+        {
+            exact = (uint32_t)((((double)raw * ADC_VREF_MV) / (double)full_scales[i]) + 0.5);
+            mv = SIG_Q16_MUL(raw, scale);
+            TEST_CHECK((mv + 1U >= exact) && (mv <= exact + 1U));
+        }
+
+        TEST_CHECK(SIG_Q16_MUL(full_scales[i], scale) == ADC_VREF_MV);
+    }
+}
+
+/**
+ * @brief Trung bình trượt bằng tổng tăng dần phải bằng trung bình tính lại từ đầu.
+ */
+static void bench_check_movavg(void)
+{
+    static const uint8_t lengths[] = { 1U, 5U, 8U, SIG_MOVAVG_MAX_LENGTH };
+    uint16_t window[SIG_MOVAVG_MAX_LENGTH];
+    SIG_MovAvg_t filter;
+    uint32_t sum = 0;
+    uint32_t count = 0;
+    uint16_t out = 0;
+
+    TEST_CHECK(SIG_MovAvgInit(&filter, window, 0U) == 0);
+    TEST_CHECK(SIG_MovAvgInit(&filter, window, SIG_MOVAVG_MAX_LENGTH + 1U) == 0);
+
+    for (uint32_t i = 0; i < (sizeof(lengths) / sizeof(lengths[0])); i++)
+    {
+        TEST_CHECK(SIG_MovAvgInit(&filter, window, lengths[i]) == 1);
+
+        for (uint32_t n = 0; n < 20000U; n++)
+        {
+            out = SIG_MovAvgUpdate(&filter, s_samples[n]);
+
+            count = ((n + 1U) < lengths[i]) ? (n + 1U) : lengths[i];
+            sum = 0;
+            for (uint32_t k = 0; k < count; k++)
+            {
+                sum += s_samples[n - k];
+            }
+            TEST_CHECK(out == (uint16_t)((sum + (count / 2U)) / count));
+        }
+    }
+
+    /* Tổng lớn nhất 64 * 65535 không tràn */
+    TEST_CHECK(SIG_MovAvgInit(&filter, window, SIG_MOVAVG_MAX_LENGTH) == 1);
+    for (uint32_t n = 0; n < (2U * SIG_MOVAVG_MAX_LENGTH); n++)
+    {
+        out = SIG_MovAvgUpdate(&filter, 0xFFFFU);
+    }
+    TEST_CHECK(out == 0xFFFFU);
+}
+
+/**
+ * @brief IIR: mẫu đầu tiên làm giá trị ban đầu, đáp ứng bậc thang đơn điệu, về đúng giá
+ * trị cuối trong số bước giới hạn và không vượt ra ngoài khoảng của đầu vào.
+ */
+static void bench_check_iir(void)
+{
+    SIG_Iir_t filter;
+    uint16_t out = 0;
+    uint16_t previous = 0;
+    uint32_t steps = 0;
+
+    TEST_CHECK(SIG_IirInit(&filter, 8U) == 0);
+
+    for (uint8_t shift = 0; shift <= 7U; shift++)
+    {
+        TEST_CHECK(SIG_IirInit(&filter, shift) == 1);
+        TEST_CHECK(SIG_IirUpdate(&filter, 0U) == 0U);
+
+        /* Bậc thang 0 -> 65535 rồi về 0 */
+        previous = 0;
+        steps = 0;
+        do
+        {
+            out = SIG_IirUpdate(&filter, 0xFFFFU);
+            TEST_CHECK(out >= previous);
+            previous = out;
+            steps++;
+        } while ((out != 0xFFFFU) && (steps < 10000U));
+        TEST_CHECK(steps <= (24U << shift));
+
+        steps = 0;
+        do
+        {
+            out = SIG_IirUpdate(&filter, 0U);
+            TEST_CHECK(out <= previous);
+            previous = out;
+            steps++;
+        } while ((out != 0U) && (steps < 10000U));
+        TEST_CHECK(steps <= (24U << shift));
+    }
+
+    /* Đầu vào ngẫu nhiên trong [1000, 1255]: đầu ra ở trong cùng khoảng */
+    TEST_CHECK(SIG_IirInit(&filter, BENCH_IIR_SHIFT) == 1);
+    for (uint32_t n = 0; n < 100000U; n++)
+    {
+        out = SIG_IirUpdate(&filter, (uint16_t)(1000U + (bench_random() & 0xFFU)));
+        TEST_CHECK((out >= 1000U) && (out <= 1255U));
+    }
+}
+
+/**
+ * @brief Bộ phân loại: băng đổi đúng tại ngưỡng cộng/trừ độ trễ, không dao động khi giá
+ * trị dao động quanh ngưỡng trong độ trễ, nhảy qua nhiều băng trong một lần gọi.
+ */
+static void bench_check_classifier(void)
+{
+    SIG_Classifier_t classifier;
+    static const uint32_t bad_thresholds[BENCH_BANDS - 1U] = { 1250U, 1250U, 3750U };
+    uint8_t band = 0;
+    uint8_t expected = 0;
+
+    TEST_CHECK(SIG_ClassifierInit(&classifier, s_thresholdsMv, 1U, BENCH_HYSTERESIS_MV) == 0);
+    TEST_CHECK(SIG_ClassifierInit(&classifier, bad_thresholds, BENCH_BANDS, BENCH_HYSTERESIS_MV) == 0);
+
+    /* Lần đầu không có độ trễ, giống chuỗi so sánh cũ */
+    for (uint32_t mv = 0; mv <= ADC_VREF_MV; mv++)
+    {
+        TEST_CHECK(SIG_ClassifierInit(&classifier, s_thresholdsMv, BENCH_BANDS, BENCH_HYSTERESIS_MV) == 1);
+        expected = (mv < 1250U) ? 0 : ((mv < 2500U) ? 1 : ((mv < 3750U) ? 2 : 3));
+        TEST_CHECK(SIG_Classify(&classifier, mv) == expected);
+    }
+
+    /* Dốc lên: đổi băng tại ngưỡng + độ trễ */
+    TEST_CHECK(SIG_ClassifierInit(&classifier, s_thresholdsMv, BENCH_BANDS, BENCH_HYSTERESIS_MV) == 1);
+    for (uint32_t mv = 0; mv <= ADC_VREF_MV; mv++)
+    {
+        band = SIG_Classify(&classifier, mv);
+        expected = (mv < 1300U) ? 0 : ((mv < 2550U) ? 1 : ((mv < 3800U) ? 2 : 3));
+        TEST_CHECK(band == expected);
+    }
+
+    /* Dốc xuống: đổi băng khi thấp hơn ngưỡng - độ trễ */
+    for (uint32_t mv = ADC_VREF_MV + 1U; mv-- > 0U; )
+    {
+        band = SIG_Classify(&classifier, mv);
+        expected = (mv >= 3700U) ? 3 : ((mv >= 2450U) ? 2 : ((mv >= 1200U) ? 1 : 0));
+        TEST_CHECK(band == expected);
+    }
+
+    /* Nhiễu quanh ngưỡng 2500 trong độ trễ: băng giữ nguyên */
+    TEST_CHECK(SIG_ClassifierInit(&classifier, s_thresholdsMv, BENCH_BANDS, BENCH_HYSTERESIS_MV) == 1);
+    TEST_CHECK(SIG_Classify(&classifier, 2500U) == 2);
+    for (uint32_t n = 0; n < 10000U; n++)
+    {
+        TEST_CHECK(SIG_Classify(&classifier, 2451U + (bench_random() % 98U)) == 2);
+    }
+
+    /* Nhảy từ băng thấp nhất lên cao nhất và ngược lại trong một lần gọi */
+    TEST_CHECK(SIG_Classify(&classifier, 0U) == 0);
+    TEST_CHECK(SIG_Classify(&classifier, ADC_VREF_MV) == 3);
+    TEST_CHECK(SIG_Classify(&classifier, 0U) == 0);
+}
+
+static double bench_legacy(void)
+{
+    uint64_t start = test_now_ns();
+    uint32_t sum = 0;
+
+    for (uint32_t n = 0; n < BENCH_SAMPLES; n++)
+    {
+        sum += bench_legacy_path(s_samples[n]);
+    }
+    s_sink = sum;
+
+    return (double)(test_now_ns() - start) / (double)BENCH_SAMPLES;
+}
+
+static double bench_fixed_point(void)
+{
+    SIG_Classifier_t classifier;
+    SIG_Iir_t filter;
+    uint32_t scale = SIG_Q16(ADC_VREF_MV, 255U);
+    uint64_t start = 0;
+    uint32_t sum = 0;
+
+    (void)SIG_ClassifierInit(&classifier, s_thresholdsMv, BENCH_BANDS, BENCH_HYSTERESIS_MV);
+    (void)SIG_IirInit(&filter, BENCH_IIR_SHIFT);
+
+    start = test_now_ns();
+    for (uint32_t n = 0; n < BENCH_SAMPLES; n++)
+    {
+        sum += SIG_Classify(&classifier,
+                            SIG_IirUpdate(&filter, (uint16_t)SIG_Q16_MUL(s_samples[n], scale)));
+    }
+    s_sink = sum;
+
+    return (double)(test_now_ns() - start) / (double)BENCH_SAMPLES;
+}
+
+static double bench_movavg(uint8_t length)
+{
+    uint16_t window[SIG_MOVAVG_MAX_LENGTH];
+    SIG_MovAvg_t filter;
+    uint64_t start = 0;
+    uint32_t sum = 0;
+
+    (void)SIG_MovAvgInit(&filter, window, length);
+
+    start = test_now_ns();
+    for (uint32_t n = 0; n < BENCH_SAMPLES; n++)
+    {
+        sum += SIG_MovAvgUpdate(&filter, s_samples[n]);
+    }
+    s_sink = sum;
+
+    return (double)(test_now_ns() - start) / (double)BENCH_SAMPLES;
+}
+
+/**
+ * @brief Trường hợp xấu nhất của bộ phân loại: mỗi lần gọi đi qua mọi băng.
+ */
+static double bench_classify_worst(void)
+{
+    SIG_Classifier_t classifier;
+    uint64_t start = 0;
+    uint32_t sum = 0;
+
+    (void)SIG_ClassifierInit(&classifier, s_thresholdsMv, BENCH_BANDS, BENCH_HYSTERESIS_MV);
+
+    start = test_now_ns();
+    for (uint32_t n = 0; n < BENCH_SAMPLES; n++)
+    {
+        sum += SIG_Classify(&classifier, ((n & 1U) != 0U) ? ADC_VREF_MV : 0U);
+    }
+    s_sink = sum;
+
+    return (double)(test_now_ns() - start) / (double)BENCH_SAMPLES;
+}
+
+int main(void)
+{
+    for (uint32_t n = 0; n < BENCH_SAMPLES; n++)
+    {
+        s_samples[n] = (uint16_t)((((n >> 10) & 0xFFU) + (bench_random() & 0x0FU)) & 0xFFU);
+    }
+
+    bench_check_q16();
+    bench_check_movavg();
+    bench_check_iir();
+    bench_check_classifier();
+
+    printf("bench_sig_cond: %lu samples\n", BENCH_SAMPLES);
+    printf("  float mV + range chain (old)       : %6.2f ns/sample\n", bench_legacy());
+    printf("  Q16 mV + IIR + hysteresis classify : %6.2f ns/sample\n", bench_fixed_point());
+    printf("  moving average, 8 samples          : %6.2f ns/sample\n", bench_movavg(8U));
+    printf("  moving average, 64 samples         : %6.2f ns/sample\n", bench_movavg(SIG_MOVAVG_MAX_LENGTH));
+    printf("  classify, every band crossed       : %6.2f ns/sample\n", bench_classify_worst());
+
+    return TEST_RESULT("bench_sig_cond");
+}
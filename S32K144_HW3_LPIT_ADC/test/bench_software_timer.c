@@ -0,0 +1,141 @@
+/**
+ * @file bench_software_timer.c
+ * @brief Benchmark trên máy host của ngắt tick software timer: heap deadline so với
+ * cách cũ duyệt và giảm bộ đếm của mọi timer trong mỗi tick.
+ * @details Biên dịch ở chế độ tick (TIM_TICKLESS = 0) để mỗi lần gọi ISR là một tick 1ms
+ * như cách cũ. Mỗi timer chạy định kỳ với chu kỳ khác nhau. Thời gian đo trên host chỉ
+ * dùng để so sánh hai cách, không phải số chu kỳ trên chip.
+ *
+ * @author Nguyen Vuong Trung Nam
+ * @date Oct 17, 2026
+ */
+
+#include "test_common.h"
+#include "software_timer.h"
+
+/* Số tick đo cho mỗi số lượng timer */
+#define BENCH_TICKS             100000U
+
+/* Số tick kiểm tra lịch hết hạn của heap */
+#define BENCH_CHECK_TICKS       3000U
+
+void LPIT0_Ch0_IRQHandler(void);
+
+static const uint16_t s_counts[] = { 16U, 64U, 256U, MAX_SOFTWARE_TIMERS };
+
+/* Bộ đếm và cờ của cách cũ, cùng chu kỳ với heap */
+static uint32_t s_legacyCounter[MAX_SOFTWARE_TIMERS];
+static uint32_t s_legacyPeriod[MAX_SOFTWARE_TIMERS];
+static volatile uint8_t s_legacyFlag[MAX_SOFTWARE_TIMERS];
+
+/**
+ * @brief Chu kỳ (ms) của timer thứ index, từ 20ms đến 1s.
+ */
+static uint32_t bench_period(uint16_t index)
+{
+    return 20U + (((uint32_t)index * 37U) % 981U);
+}
+
+/**
+ * @brief ISR tick của cách cũ: giảm bộ đếm của mọi timer, nạp lại khi về 0.
+ */
+static void bench_legacy_tick(uint16_t count)
+{
+    for (uint16_t i = 0; i < count; i++)
+    {
+        if (s_legacyCounter[i] > 0)
+        {
+            s_legacyCounter[i]--;
+
+            if (0 == s_legacyCounter[i])
+            {
+                s_legacyFlag[i] = 1;
+                s_legacyCounter[i] = s_legacyPeriod[i];
+            }
+        }
+    }
+}
+
+static void bench_start_timers(uint16_t count)
+{
+    TIM_Init();
+
+    for (uint16_t i = 0; i < count; i++)
+    {
+        TEST_CHECK(TIM_SetTimeEx(i, bench_period(i), TIM_MODE_PERIODIC) == 1);
+        s_legacyPeriod[i] = bench_period(i);
+        s_legacyCounter[i] = bench_period(i);
+        s_legacyFlag[i] = 0;
+    }
+}
+
+/**
+ * @brief Kiểm tra heap bật cờ đúng tick: lần đầu sau chu kỳ + 1 tick (deadline tính
+ * từ tick kế tiếp), sau đó đúng mỗi chu kỳ.
+ */
+static void bench_check_schedule(uint16_t count)
+{
+    uint32_t period = 0;
+    uint8_t expected = 0;
+
+    bench_start_timers(count);
+
+    for (uint32_t tick = 1; tick <= BENCH_CHECK_TICKS; tick++)
+    {
+        LPIT0_Ch0_IRQHandler();
+
+        for (uint16_t i = 0; i < count; i++)
+        {
+            period = bench_period(i);
+            expected = ((tick > period) && (0 == ((tick - 1U) % period))) ? 1 : 0;
+            TEST_CHECK(TIM_IsFlag(i) == expected);
+        }
+    }
+}
+
+static double bench_heap(uint16_t count)
+{
+    uint64_t start = 0;
+
+    bench_start_timers(count);
+
+    start = test_now_ns();
+    for (uint32_t tick = 0; tick < BENCH_TICKS; tick++)
+    {
+        LPIT0_Ch0_IRQHandler();
+    }
+
+    return (double)(test_now_ns() - start) / (double)BENCH_TICKS;
+}
+
+static double bench_legacy(uint16_t count)
+{
+    uint64_t start = 0;
+
+    bench_start_timers(count);
+
+    start = test_now_ns();
+    for (uint32_t tick = 0; tick < BENCH_TICKS; tick++)
+    {
+        bench_legacy_tick(count);
+    }
+
+    return (double)(test_now_ns() - start) / (double)BENCH_TICKS;
+}
+
+int main(void)
+{
+    uint16_t count = 0;
+
+    printf("bench_software_timer: %u ticks, periodic timers of 20..1000 ms\n", BENCH_TICKS);
+    printf("  timers   heap ns/tick   scan ns/tick\n");
+
+    for (uint32_t i = 0; i < (sizeof(s_counts) / sizeof(s_counts[0])); i++)
+    {
+        count = s_counts[i];
+        bench_check_schedule(count);
+        printf("  %6u   %12.2f   %12.2f\n", (unsigned)count, bench_heap(count), bench_legacy(count));
+    }
+
+    return TEST_RESULT("bench_software_timer");
+}
@@ -0,0 +1,38 @@
+/**
+ * @file S32K144.h
+ * @brief Header thiết bị cho bản build trên máy host.
+ * @details Dùng định nghĩa thanh ghi thật, sau đó trỏ các ngoại vi mà test dùng tới
+ * các khối thanh ghi trong RAM (sim_stubs.c) thay cho địa chỉ của chip. Các macro
+ * critical section của hal_irq.h được thay bằng bản rỗng vì host không có BASEPRI/PRIMASK
+ * và benchmark chạy trên một luồng. Thư mục sim/ phải đứng trước ../include.
+ *
+ * @author Nguyen Vuong Trung Nam
+ * @date Oct 17, 2026
+ */
+
+#ifndef SIM_S32K144_H_
+#define SIM_S32K144_H_
+
+#include "../../include/S32K144.h"
+
+extern LPIT_Type sim_lpit;
+extern PCC_Type sim_pcc;
+
+#undef IP_LPIT0
+#define IP_LPIT0        (&sim_lpit)
+
+#undef IP_PCC
+#define IP_PCC          (&sim_pcc)
+
+/* Thay cho các macro dùng BASEPRI/PRIMASK trong hal_irq.h */
+#define HAL_IRQ_ENTER_CRITICAL(state)   ((state) = 0U)
+#define HAL_IRQ_EXIT_CRITICAL(state)    ((void)(state))
+#define HAL_IRQ_DISABLE_ALL(state)      ((state) = 0U)
+#define HAL_IRQ_RESTORE_ALL(state)      ((void)(state))
+
+/**
+ * @brief Số chu kỳ clock LPIT của bộ đếm thời gian giả lập, test tự cho thời gian trôi.
+ */
+extern uint64_t sim_time_cycles;
+
+#endif /* SIM_S32K144_H_ */
@@ -0,0 +1,51 @@
+/**
+ * @file test_common.h
+ * @brief Các macro kiểm tra và hàm đo thời gian dùng chung cho benchmark trên máy host.
+ *
+ * @author Nguyen Vuong Trung Nam
+ * @date Oct 17, 2026
+ */
+
+#ifndef TEST_COMMON_H_
+#define TEST_COMMON_H_
+
+#include <stdio.h>
+#include <stdint.h>
+#include <time.h>
+
+/**
+ * @brief Ghi nhận một kiểm tra sai và tiếp tục chạy, một lần chạy báo mọi lỗi.
+ */
+#define TEST_CHECK(cond)                                                        \
+    do                                                                          \
+    {                                                                           \
+        if (!(cond))                                                            \
+        {                                                                       \
+            printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond);     \
+            s_testFailures++;                                                   \
+        }                                                                       \
+    } while (0)
+
+/**
+ * @brief In kết quả và trả về exit code của tiến trình.
+ */
+#define TEST_RESULT(name)                                                       \
+    ((0U == s_testFailures) ? (printf("%s: PASS\n", (name)), 0)                 \
+                            : (printf("%s: %u FAILED\n", (name), (unsigned)s_testFailures), 1))
+
+static uint32_t s_testFailures = 0U;
+
+/**
+ * @brief Đọc mốc thời gian đơn điệu cho benchmark.
+ * @return uint64_t Thời gian tính bằng nano-giây.
+ */
+static inline uint64_t test_now_ns(void)
+{
+    struct timespec ts;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ((uint64_t)ts.tv_sec * 1000000000ULL) + (uint64_t)ts.tv_nsec;
+}
+
+#endif /* TEST_COMMON_H_ */
@@ -9,18 +9,167 @@
  */
 
 #include "adc.h"
+#include "sig_cond.h"
 
 /**
- * @brief  Khởi tạo, hiệu chuẩn và cấu hình ADC0.
- * @note   Hàm này thực hiện toàn bộ quá trình thiết lập cho ADC0, bao gồm
- * cấp xung nhịp, hiệu chuẩn bắt buộc và cấu hình cho chế độ hoạt động
- * bình thường (8-bit, software trigger). Hàm này chỉ nên được gọi một
- * lần khi hệ thống khởi động.
- * @warning Logic kiểm tra lỗi hiệu chuẩn trong hàm này chưa chính xác.
- * @return ADC_SUCCESS nếu thành công, ADC_INIT_FAIL nếu thất bại.
+ * @brief Chế độ đang sử dụng SC1/R và PDB0, các chế độ loại trừ lẫn nhau.
  */
-uint8_t ADC_Init(void)
+#define ADC_MODE_IDLE       0U
+#define ADC_MODE_STREAM     1U
+#define ADC_MODE_SCAN       2U
+#define ADC_MODE_CAL        3U
+#define ADC_MODE_SINGLE     4U
+
+/**
+ * @brief Số pre-trigger của một kênh PDB, mỗi kênh PDB phục vụ 8 thanh ghi SC1 liên tiếp.
+ */
+#define ADC_PDB_PRETRIGGERS     8U
+
+static volatile uint8_t adc_mode = ADC_MODE_IDLE;
+static volatile uint32_t adc_overruns = 0;
+
+/**
+ * @brief Trạng thái của hiệu chuẩn không chặn.
+ */
+static uint64_t adc_cal_deadline = 0;
+static uint8_t adc_cal_status = ADC_INIT_FAIL;
+
+/**
+ * @brief Chuyển đổi bất đồng bộ đang chờ, được dùng chung với ADC0_IRQHandler.
+ */
+static volatile ADC_ConversionCallback_t adc_conv_callback = NULL;
+static volatile uint8_t adc_conv_channel = 0;
+static volatile uint32_t adc_conv_sum = 0;
+static volatile uint16_t adc_conv_remaining = 0;
+
+/**
+ * @brief Các profile có sẵn.
+ */
+const ADC_Profile_t ADC_ProfileFast     = { ADC_RES_8BIT,  ADC_HWAVG_NONE, 12U, 0U };
+const ADC_Profile_t ADC_ProfileBalanced = { ADC_RES_12BIT, ADC_HWAVG_4,    24U, 0U };
+const ADC_Profile_t ADC_ProfilePrecise  = { ADC_RES_12BIT, ADC_HWAVG_16,   64U, 2U };
+
+/**
+ * @brief Số bit của từng độ phân giải, đánh chỉ số theo trường MODE.
+ */
+static const uint8_t adc_resolution_bits[3] = { 8U, 12U, 10U };
+
+/**
+ * @brief Profile hiện tại và các giá trị suy ra từ nó.
+ */
+static const ADC_Profile_t *adc_profile = &ADC_ProfileFast;
+static uint8_t adc_result_bits = 8U;
+static uint32_t adc_mv_scale_q16 = SIG_Q16(ADC_VREF_MV, 255U);
+
+/**
+ * @brief  Ghi cấu hình của profile hiện tại vào các thanh ghi ADC0.
+ */
+static void ADC_ApplyProfile(void)
+{
+    /* Thiết lập cấu hình hoạt động: clock nguồn, độ phân giải và bộ chia */
+    IP_ADC0->CFG1 = ADC_CFG1_ADICLK(0) |                          /* Chọn Alternate Clock 1 làm clock nội bộ */
+                  ADC_CFG1_MODE(adc_profile->resolution) |      /* Cấu hình độ phân giải */
+                  ADC_CFG1_ADIV(1);                             /* Cấu hình bộ chia clock là 2 */
+
+    IP_ADC0->CFG2 = ADC_CFG2_SMPLTS(adc_profile->sample_time);
+
+    /* Xóa CAL và ADCO, chỉ giữ trung bình phần cứng của profile */
+    if (ADC_HWAVG_NONE != adc_profile->hw_average)
+    {
+        IP_ADC0->SC3 = ADC_SC3_AVGE_MASK | ADC_SC3_AVGS(adc_profile->hw_average - ADC_HWAVG_4);
+    }
+    else
+    {
+        IP_ADC0->SC3 = 0;
+    }
+}
+
+/**
+ * @brief Trạng thái của chế độ streaming, được dùng chung với DMA0_IRQHandler.
+ */
+static uint16_t *volatile adc_stream_buffer = NULL;
+static volatile uint16_t adc_stream_block_len = 0;
+static volatile ADC_BlockCallback_t adc_stream_callback = NULL;
+
+/**
+ * @brief Trạng thái của nhóm quét, được dùng chung với ADC0_IRQHandler.
+ */
+static ADC_ScanBuffer_t *volatile adc_scan_buffer = NULL;
+static volatile uint8_t adc_scan_count = 0;
+static volatile uint8_t adc_scan_busy = 0;
+
+/**
+ * @brief  Tính bộ chia và số xung PDB cho một tần số trigger.
+ * @details Chọn bộ chia nhỏ nhất để chu kỳ vừa với thanh ghi MOD 16-bit.
+ * @param[in]  rate_hz Tần số trigger (Hz).
+ * @param[out] prescaler Giá trị trường PRESCALER.
+ * @param[out] ticks Số xung PDB của một chu kỳ.
+ * @return 1 nếu đạt được tần số, 0 nếu không.
+ */
+static uint8_t ADC_PdbCompute(uint32_t rate_hz, uint8_t *prescaler, uint32_t *ticks)
+{
+    for (uint8_t p = 0; p < 8; p++)
+    {
+        *prescaler = p;
+        *ticks = (ADC_PDB_CLOCK_HZ >> p) / rate_hz;
+        if (*ticks <= (PDB_MOD_MOD_MASK + 1U))
+        {
+            return (*ticks >= 2) ? 1 : 0;
+        }
+    }
+
+    return 0;
+}
+
+/**
+ * @brief  Cấp clock và cấu hình bộ đếm của PDB0 với software trigger.
+ * @note   Pre-trigger do hàm gọi cấu hình, sau đó ghi LDOK để nạp MOD và DLY.
+ * @param[in] prescaler Giá trị trường PRESCALER.
+ * @param[in] ticks Số xung PDB của một chu kỳ.
+ * @param[in] continuous 1: PDB tự lặp lại sau software trigger đầu tiên, 0: mỗi trigger một chu kỳ.
+ */
+static void ADC_PdbConfigure(uint8_t prescaler, uint32_t ticks, uint8_t continuous)
+{
+    IP_PCC->PCCn[PCC_PDB0_INDEX] |= PCC_PCCn_CGC_MASK;
+
+    /* Trigger và pre-trigger của ADC0 lấy từ PDB0 */
+    IP_SIM->ADCOPT &= ~(SIM_ADCOPT_ADC0TRGSEL_MASK | SIM_ADCOPT_ADC0PRETRGSEL_MASK);
+
+    IP_PDB0->SC = 0;
+    IP_PDB0->SC = PDB_SC_PRESCALER(prescaler) | PDB_SC_MULT(0) | PDB_SC_TRGSEL(15)
+                | PDB_SC_CONT(continuous) | PDB_SC_PDBEIE_MASK | PDB_SC_PDBEN_MASK;
+    IP_PDB0->MOD = ticks - 1U;
+
+    for (uint8_t ch = 0; ch < PDB_CH_COUNT; ch++)
+    {
+        IP_PDB0->CH[ch].C1 = 0;
+        IP_PDB0->CH[ch].S = 0;
+    }
+}
+
+/**
+ * @brief  Dừng PDB0 và trả ADC về chế độ software trigger như sau ADC_Init().
+ */
+static void ADC_PdbStop(void)
+{
+    IP_PDB0->SC &= ~(PDB_SC_CONT_MASK | PDB_SC_PDBEN_MASK);
+    HAL_IRQ_Disable(PDB0_IRQn);
+
+    IP_ADC0->SC2 = ADC_SC2_ADTRG(0);
+    IP_ADC0->SC1[0] = ADC_SC1_ADCH_MASK;
+}
+
+/**
+ * @brief  Cấp clock cho ADC0 và bắt đầu hiệu chuẩn, không chờ kết quả.
+ * @copydoc ADC_StartCalibration
+ */
+uint8_t ADC_StartCalibration(void)
 {
+    if (ADC_MODE_IDLE != adc_mode)
+    {
+        return ADC_BUSY;
+    }
+
     /* BƯỚC 1: BẬT VÀ CHỌN NGUỒN CLOCK CHO ADC0 TỪ PCC */
 
     /* Xóa cấu hình clock cũ của ADC0 trong thanh ghi PCC */
@@ -35,48 +184,542 @@ uint8_t ADC_Init(void)
     /* Vô hiệu hóa ADC bằng cách chọn kênh không hợp lệ, đảm bảo ADC ở trạng thái nghỉ */
     IP_ADC0->SC1[0] = ADC_SC1_ADCH_MASK;
 
+    /* Hiệu chuẩn phải chạy với software trigger */
+    IP_ADC0->SC2 = ADC_SC2_ADTRG(0);
+
     /* Cấu hình bộ chia clock chậm (chia 8) để đảm bảo hiệu chuẩn chính xác */
     IP_ADC0->CFG1 = ADC_CFG1_ADIV(3);
 
+    adc_cal_deadline = time_now_us() + ADC_CAL_TIMEOUT_US;
+    adc_mode = ADC_MODE_CAL;
+
     /* Bắt đầu quá trình hiệu chuẩn: bật hardware average, chọn 32 mẫu, và set cờ CAL */
     IP_ADC0->SC3 = ADC_SC3_AVGE_MASK | ADC_SC3_AVGS(3) | ADC_SC3_CAL_MASK;
 
-    /* Vòng lặp chờ cho đến khi quá trình hiệu chuẩn hoàn tất, chỉ định bởi cờ COCO */
-    while (!(IP_ADC0->SC1[0] & ADC_SC1_COCO_MASK)) {}
+    return ADC_SUCCESS;
+}
 
-    /* Kiểm tra xem hiệu chuẩn có thất bại không */
-    if (IP_ADC0->SC3 & ADC_SC3_CAL_MASK) {
-        return ADC_INIT_FAIL;
+/**
+ * @brief  Kiểm tra tiến trình hiệu chuẩn, cấu hình ADC0 khi hiệu chuẩn xong.
+ * @copydoc ADC_PollCalibration
+ */
+uint8_t ADC_PollCalibration(void)
+{
+    if (ADC_MODE_CAL != adc_mode)
+    {
+        return adc_cal_status;
     }
 
-    /* BƯỚC 3: CẤU HÌNH CHO HOẠT ĐỘNG BÌNH THƯỜNG */
+    /*
+     * Hiệu chuẩn kết thúc khi COCO được set. ADC0 của S32K144 không có cờ CALF:
+     * hiệu chuẩn được xem là thất bại nếu CAL vẫn còn set lúc COCO báo xong,
+     * hoặc nếu COCO không xuất hiện trước hạn chờ.
+     */
+    if (!(IP_ADC0->SC1[0] & ADC_SC1_COCO_MASK))
+    {
+        if (time_now_us() < adc_cal_deadline)
+        {
+            return ADC_CAL_PENDING;
+        }
 
-    /* Thiết lập cấu hình hoạt động: clock nguồn, độ phân giải 8-bit và bộ chia */
-    IP_ADC0->CFG1 = ADC_CFG1_ADICLK(0) |   /* Chọn Alternate Clock 1 làm clock nội bộ */
-                  ADC_CFG1_MODE(0)   |   /* Cấu hình độ phân giải 8-BIT */
-                  ADC_CFG1_ADIV(1);      /* Cấu hình bộ chia clock là 2 */
+        /* Quá thời gian: hủy hiệu chuẩn */
+        IP_ADC0->SC3 = 0;
+        adc_cal_status = ADC_INIT_FAIL;
+    }
+    else if (IP_ADC0->SC3 & ADC_SC3_CAL_MASK)
+    {
+        adc_cal_status = ADC_INIT_FAIL;
+    }
+    else
+    {
+        /* BƯỚC 3: CẤU HÌNH CHO HOẠT ĐỘNG BÌNH THƯỜNG THEO PROFILE */
 
-    /* Chọn chế độ kích hoạt chuyển đổi bằng phần mềm */
-    IP_ADC0->SC2 = ADC_SC2_ADTRG(0);
-    /* Xóa thanh ghi SC3 để tắt chế độ hiệu chuẩn và các chế độ khác */
-    IP_ADC0->SC3 = 0;
+        ADC_ApplyProfile();
 
-    return ADC_SUCCESS;
+        /* Chọn chế độ kích hoạt chuyển đổi bằng phần mềm */
+        IP_ADC0->SC2 = ADC_SC2_ADTRG(0);
+
+        adc_cal_status = ADC_SUCCESS;
+    }
+
+    /* Đọc R[0] để xóa COCO của lần hiệu chuẩn */
+    (void)IP_ADC0->R[0];
+    adc_mode = ADC_MODE_IDLE;
+
+    return adc_cal_status;
+}
+
+/**
+ * @brief  Khởi tạo, hiệu chuẩn và cấu hình ADC0.
+ * @note   Hàm này thực hiện toàn bộ quá trình thiết lập cho ADC0, bao gồm
+ * cấp xung nhịp, hiệu chuẩn bắt buộc và cấu hình cho chế độ hoạt động
+ * bình thường (theo profile, software trigger), và chờ cho đến khi hiệu chuẩn xong.
+ * Hàm này chỉ nên được gọi một lần khi hệ thống khởi động.
+ * @return ADC_SUCCESS nếu thành công, ADC_INIT_FAIL nếu thất bại.
+ */
+uint8_t ADC_Init(void)
+{
+    uint8_t status = ADC_StartCalibration();
+
+    if (ADC_SUCCESS != status)
+    {
+        return ADC_INIT_FAIL;
+    }
+
+    do
+    {
+        status = ADC_PollCalibration();
+    } while (ADC_CAL_PENDING == status);
+
+    return status;
 }
 
 /**
- * @brief  Thực hiện một lần chuyển đổi ADC trên một kênh chỉ định.
+ * @brief  Thực hiện một lần đọc ADC trên một kênh chỉ định.
+ * @details Với oversampling, kết quả là tổng của 4^n lần chuyển đổi dịch phải n bit.
  * @param  channel Số thứ tự của kênh analog cần đọc giá trị.
- * @return Giá trị số 8-bit (0-255) sau khi chuyển đổi.
+ * @return Giá trị số theo số bit của profile, ADC_READ_TIMEOUT nếu quá thời gian chờ.
  */
 uint16_t ADC_Read_Channel(uint8_t channel)
 {
-    /* Ghi vào thanh ghi SC1 để chọn kênh và bắt đầu một lần chuyển đổi mới */
+    uint64_t deadline = 0;
+    uint32_t sum = 0;
+    uint8_t shift = adc_profile->oversample_bits;
+    uint16_t samples = (uint16_t)(1U << (2U * shift));
+
+    /* SC1[0] đang được dùng bởi hiệu chuẩn, chuyển đổi bất đồng bộ hoặc PDB */
+    if (ADC_MODE_IDLE != adc_mode)
+    {
+        return ADC_READ_TIMEOUT;
+    }
+
+    while (samples > 0)
+    {
+        /* Ghi vào thanh ghi SC1 để chọn kênh và bắt đầu một lần chuyển đổi mới */
+        IP_ADC0->SC1[0] = ADC_SC1_ADCH(channel);
+
+        /* Vòng lặp chờ cho đến khi chuyển đổi hoàn tất, chỉ định bởi cờ COCO */
+        deadline = time_now_us() + ADC_CONV_TIMEOUT_US;
+        while (!(IP_ADC0->SC1[0] & ADC_SC1_COCO_MASK))
+        {
+            if (time_now_us() >= deadline)
+            {
+                return ADC_READ_TIMEOUT;
+            }
+        }
+
+        /* Đọc giá trị từ thanh ghi kết quả. Thao tác này cũng tự động xóa cờ COCO. */
+        sum += IP_ADC0->R[0];
+        samples--;
+    }
+
+    return (uint16_t)(sum >> shift);
+}
+
+/**
+ * @brief  Chọn profile lấy mẫu.
+ * @copydoc ADC_SetProfile
+ */
+uint8_t ADC_SetProfile(const ADC_Profile_t *profile)
+{
+    uint32_t full_scale = 0;
+
+    if ((NULL == profile) || (profile->resolution > ADC_RES_10BIT)
+        || (profile->hw_average > ADC_HWAVG_32)
+        || (profile->oversample_bits > ADC_MAX_OVERSAMPLE_BITS))
+    {
+        return ADC_PARAM_FAIL;
+    }
+
+    if (ADC_MODE_IDLE != adc_mode)
+    {
+        return ADC_BUSY;
+    }
+
+    adc_profile = profile;
+    adc_result_bits = adc_resolution_bits[profile->resolution] + profile->oversample_bits;
+
+    /* mV = raw * VREF / full_scale, hệ số Q16 làm tròn đến gần nhất */
+    full_scale = (1UL << adc_result_bits) - 1U;
+    adc_mv_scale_q16 = SIG_Q16(ADC_VREF_MV, full_scale);
+
+    /* Trước khi hiệu chuẩn xong, PollCalibration sẽ áp dụng profile */
+    if (ADC_SUCCESS == adc_cal_status)
+    {
+        ADC_ApplyProfile();
+    }
+
+    return ADC_SUCCESS;
+}
+
+/**
+ * @brief  Số bit của kết quả theo profile hiện tại.
+ * @copydoc ADC_GetResultBits
+ */
+uint8_t ADC_GetResultBits(void)
+{
+    return adc_result_bits;
+}
+
+/**
+ * @brief  Đổi kết quả ADC sang mV.
+ * @copydoc ADC_ToMillivolts
+ */
+uint32_t ADC_ToMillivolts(uint16_t raw)
+{
+    /* Tích xấp xỉ ADC_VREF_MV * 2^16 ở giá trị lớn nhất nên không tràn 32 bit */
+    return SIG_Q16_MUL(raw, adc_mv_scale_q16);
+}
+
+/**
+ * @brief  Bắt đầu một lần chuyển đổi có ngắt.
+ * @copydoc ADC_StartConversion
+ */
+uint8_t ADC_StartConversion(uint8_t channel, ADC_ConversionCallback_t callback)
+{
+    if (NULL == callback)
+    {
+        return ADC_PARAM_FAIL;
+    }
+
+    if (ADC_MODE_IDLE != adc_mode)
+    {
+        return ADC_BUSY;
+    }
+
+    adc_conv_callback = callback;
+    adc_conv_channel = channel;
+    adc_conv_sum = 0;
+    adc_conv_remaining = (uint16_t)(1U << (2U * adc_profile->oversample_bits));
+    adc_mode = ADC_MODE_SINGLE;
+
+    HAL_IRQ_Enable(ADC0_IRQn);
+
+    /* Ghi SC1[0] bắt đầu chuyển đổi, AIEN để COCO sinh ngắt thay vì phải chờ */
+    IP_ADC0->SC1[0] = ADC_SC1_ADCH(channel) | ADC_SC1_AIEN_MASK;
+
+    return ADC_SUCCESS;
+}
+
+/**
+ * @brief  Bắt đầu lấy mẫu liên tục một kênh vào bộ đệm ping-pong.
+ * @copydoc ADC_StreamStart
+ */
+uint8_t ADC_StreamStart(uint8_t channel, uint32_t rate_hz, uint16_t *buffer,
+                        uint16_t block_len, ADC_BlockCallback_t callback)
+{
+    uint32_t ticks = 0;
+    uint8_t prescaler = 0;
+
+    if (ADC_MODE_IDLE != adc_mode)
+    {
+        return ADC_BUSY;
+    }
+
+    if ((NULL == buffer) || (NULL == callback) || (0 == rate_hz)
+        || (0 == block_len) || (block_len > ADC_STREAM_MAX_BLOCK)
+        || !ADC_PdbCompute(rate_hz, &prescaler, &ticks))
+    {
+        return ADC_PARAM_FAIL;
+    }
+
+    adc_stream_buffer = buffer;
+    adc_stream_block_len = block_len;
+    adc_stream_callback = callback;
+    adc_overruns = 0;
+    adc_mode = ADC_MODE_STREAM;
+
+    /* BƯỚC 1: eDMA CHÉP R[0] VÀO BỘ ĐỆM VÒNG GỒM HAI KHỐI */
+
+    IP_SIM->PLATCGC |= SIM_PLATCGC_CGCDMA_MASK;
+    IP_PCC->PCCn[PCC_DMAMUX_INDEX] |= PCC_PCCn_CGC_MASK;
+
+    IP_DMA->CERQ = DMA_CERQ_CERQ(ADC_DMA_CHANNEL);
+    IP_DMA->CINT = DMA_CINT_CINT(ADC_DMA_CHANNEL);
+
+    IP_DMAMUX->CHCFG[ADC_DMA_CHANNEL] = 0;
+    IP_DMAMUX->CHCFG[ADC_DMA_CHANNEL] = DMAMUX_CHCFG_SOURCE(ADC_DMA_SOURCE_ADC0) | DMAMUX_CHCFG_ENBL_MASK;
+
+    /* Mỗi yêu cầu DMA chép 2 byte, địa chỉ nguồn giữ nguyên, địa chỉ đích tăng dần */
+    IP_DMA->TCD[ADC_DMA_CHANNEL].SADDR = (uint32_t)(uintptr_t)&IP_ADC0->R[0];
+    IP_DMA->TCD[ADC_DMA_CHANNEL].SOFF = 0;
+    IP_DMA->TCD[ADC_DMA_CHANNEL].ATTR = DMA_TCD_ATTR_SSIZE(1) | DMA_TCD_ATTR_DSIZE(1);
+    IP_DMA->TCD[ADC_DMA_CHANNEL].NBYTES.MLNO = DMA_TCD_NBYTES_MLNO_NBYTES(sizeof(uint16_t));
+    IP_DMA->TCD[ADC_DMA_CHANNEL].SLAST = 0;
+    IP_DMA->TCD[ADC_DMA_CHANNEL].DADDR = (uint32_t)(uintptr_t)buffer;
+    IP_DMA->TCD[ADC_DMA_CHANNEL].DOFF = sizeof(uint16_t);
+    IP_DMA->TCD[ADC_DMA_CHANNEL].CITER.ELINKNO = DMA_TCD_CITER_ELINKNO_CITER(2U * block_len);
+    IP_DMA->TCD[ADC_DMA_CHANNEL].BITER.ELINKNO = DMA_TCD_BITER_ELINKNO_BITER(2U * block_len);
+    /* Hết vòng lặp chính thì quay địa chỉ đích về đầu bộ đệm, DMA chạy mãi không cần CPU nạp lại */
+    IP_DMA->TCD[ADC_DMA_CHANNEL].DLASTSGA = (uint32_t)(-(int32_t)(2U * block_len * sizeof(uint16_t)));
+    IP_DMA->TCD[ADC_DMA_CHANNEL].CSR = DMA_TCD_CSR_INTHALF_MASK | DMA_TCD_CSR_INTMAJOR_MASK;
+
+    HAL_IRQ_Enable(DMA0_IRQn);
+    IP_DMA->SERQ = DMA_SERQ_SERQ(ADC_DMA_CHANNEL);
+
+    /* BƯỚC 2: ADC CHUYỂN ĐỔI THEO PRE-TRIGGER CỦA PDB0 VÀ GỬI YÊU CẦU DMA */
+
+    IP_ADC0->SC2 = ADC_SC2_ADTRG(1) | ADC_SC2_DMAEN_MASK;
+    /* Với hardware trigger, ghi SC1[0] chỉ chọn kênh, chưa bắt đầu chuyển đổi */
     IP_ADC0->SC1[0] = ADC_SC1_ADCH(channel);
 
-    /* Vòng lặp chờ cho đến khi chuyển đổi hoàn tất, chỉ định bởi cờ COCO */
-    while (!(IP_ADC0->SC1[0] & ADC_SC1_COCO_MASK)) {}
+    /* BƯỚC 3: PDB0 CHẠY LIÊN TỤC LÀM NHỊP LẤY MẪU */
+
+    ADC_PdbConfigure(prescaler, ticks, 1);
+    /* Pre-trigger 0 của kênh 0 được phát mỗi khi bộ đếm đi qua DLY[0] */
+    IP_PDB0->CH[0].C1 = PDB_C1_EN(1) | PDB_C1_TOS(1);
+    IP_PDB0->CH[0].DLY[0] = 0;
+    IP_PDB0->SC |= PDB_SC_LDOK_MASK;
+
+    HAL_IRQ_Enable(PDB0_IRQn);
+
+    /* Software trigger chỉ cần một lần, sau đó PDB tự lặp lại */
+    IP_PDB0->SC |= PDB_SC_SWTRIG_MASK;
+
+    return ADC_SUCCESS;
+}
+
+/**
+ * @brief  Dừng streaming.
+ * @copydoc ADC_StreamStop
+ */
+void ADC_StreamStop(void)
+{
+    if (ADC_MODE_STREAM != adc_mode)
+    {
+        return;
+    }
+
+    /* Dừng nguồn trigger trước rồi mới dừng DMA */
+    ADC_PdbStop();
+
+    IP_DMA->CERQ = DMA_CERQ_CERQ(ADC_DMA_CHANNEL);
+    IP_DMAMUX->CHCFG[ADC_DMA_CHANNEL] = 0;
+    HAL_IRQ_Disable(DMA0_IRQn);
+
+    adc_mode = ADC_MODE_IDLE;
+}
+
+/**
+ * @brief  Cấu hình nhóm quét và bắt đầu kích hoạt bằng PDB0.
+ * @copydoc ADC_ScanStart
+ */
+uint8_t ADC_ScanStart(const uint8_t *channels, uint8_t count, ADC_ScanBuffer_t *buffer, uint32_t rate_hz)
+{
+    uint32_t ticks = PDB_MOD_MOD_MASK + 1U;
+    uint8_t prescaler = 0;
+    uint8_t pdb_ch = 0;
+    uint8_t pretrigger = 0;
+
+    if (ADC_MODE_IDLE != adc_mode)
+    {
+        return ADC_BUSY;
+    }
+
+    if ((NULL == channels) || (NULL == buffer) || (NULL == buffer->samples)
+        || (0 == count) || (count > ADC_SCAN_MAX_CHANNELS) || (0 == buffer->depth)
+        || ((0 != rate_hz) && !ADC_PdbCompute(rate_hz, &prescaler, &ticks)))
+    {
+        return ADC_PARAM_FAIL;
+    }
+
+    buffer->head = 0;
+    buffer->count = 0;
+    adc_scan_buffer = buffer;
+    adc_scan_count = count;
+    adc_scan_busy = 0;
+    adc_overruns = 0;
+    adc_mode = ADC_MODE_SCAN;
+
+    /* BƯỚC 1: MỖI KÊNH MỘT CẶP SC1/R, CHỈ KÊNH CUỐI BÁO NGẮT KHI CẢ NHÓM XONG */
+
+    IP_ADC0->SC2 = ADC_SC2_ADTRG(1);
+    for (uint8_t i = 0; i < count; i++)
+    {
+        IP_ADC0->SC1[i] = ADC_SC1_ADCH(channels[i]) | ((i == (count - 1U)) ? ADC_SC1_AIEN_MASK : 0U);
+    }
+
+    /* BƯỚC 2: PRE-TRIGGER NỐI TIẾP (BACK-TO-BACK) */
+
+    ADC_PdbConfigure(prescaler, ticks, (0 != rate_hz) ? 1 : 0);
 
-    /* Đọc giá trị từ thanh ghi kết quả và trả về. Thao tác này cũng tự động xóa cờ COCO. */
-    return (uint16_t)IP_ADC0->R[0];
+    /*
+     * Pre-trigger 0 của kênh PDB 0 phát theo bộ đếm, các pre-trigger sau được phát khi
+     * chuyển đổi trước đó hoàn tất. Kênh PDB 1 nối tiếp từ pre-trigger 7 của kênh PDB 0
+     * và phục vụ SC1[8] đến SC1[15].
+     */
+    for (uint8_t i = 0; i < count; i++)
+    {
+        pdb_ch = i / ADC_PDB_PRETRIGGERS;
+        pretrigger = i % ADC_PDB_PRETRIGGERS;
+
+        IP_PDB0->CH[pdb_ch].C1 |= PDB_C1_EN(1U << pretrigger)
+                                | ((0 == i) ? PDB_C1_TOS(1U << pretrigger) : PDB_C1_BB(1U << pretrigger));
+    }
+    IP_PDB0->CH[0].DLY[0] = 0;
+    IP_PDB0->SC |= PDB_SC_LDOK_MASK;
+
+    HAL_IRQ_Enable(ADC0_IRQn);
+    HAL_IRQ_Enable(PDB0_IRQn);
+
+    if (0 != rate_hz)
+    {
+        adc_scan_busy = 1;
+        IP_PDB0->SC |= PDB_SC_SWTRIG_MASK;
+    }
+
+    return ADC_SUCCESS;
+}
+
+/**
+ * @brief  Kích hoạt một lần quét cả nhóm.
+ * @copydoc ADC_ScanTrigger
+ */
+uint8_t ADC_ScanTrigger(void)
+{
+    if ((ADC_MODE_SCAN != adc_mode) || (IP_PDB0->SC & PDB_SC_CONT_MASK))
+    {
+        return ADC_PARAM_FAIL;
+    }
+
+    if (adc_scan_busy)
+    {
+        return ADC_BUSY;
+    }
+
+    adc_scan_busy = 1;
+    IP_PDB0->SC |= PDB_SC_SWTRIG_MASK;
+
+    return ADC_SUCCESS;
+}
+
+/**
+ * @brief  Dừng nhóm quét.
+ * @copydoc ADC_ScanStop
+ */
+void ADC_ScanStop(void)
+{
+    if (ADC_MODE_SCAN != adc_mode)
+    {
+        return;
+    }
+
+    ADC_PdbStop();
+    HAL_IRQ_Disable(ADC0_IRQn);
+
+    /* Tắt các SC1 của nhóm, đọc R để xóa COCO còn sót */
+    for (uint8_t i = 0; i < adc_scan_count; i++)
+    {
+        IP_ADC0->SC1[i] = ADC_SC1_ADCH_MASK;
+        (void)IP_ADC0->R[i];
+    }
+
+    adc_scan_busy = 0;
+    adc_mode = ADC_MODE_IDLE;
+}
+
+/**
+ * @brief  Đọc số mẫu bị mất.
+ * @copydoc ADC_GetOverruns
+ */
+uint32_t ADC_GetOverruns(void)
+{
+    return adc_overruns;
+}
+
+/**
+ * @brief  Ngắt của ADC0, xảy ra khi chuyển đổi bất đồng bộ xong hoặc khi kênh cuối
+ * của nhóm quét hoàn tất.
+ * @details Với nhóm quét, cả nhóm được chép trong một lần ngắt: R[i] đi vào mảng của
+ * kênh i tại vị trí head.
+ */
+void ADC0_IRQHandler(void)
+{
+    ADC_ScanBuffer_t *buffer = adc_scan_buffer;
+    ADC_ConversionCallback_t callback = adc_conv_callback;
+    uint8_t count = adc_scan_count;
+    uint16_t head = 0;
+    uint16_t value = 0;
+
+    if (ADC_MODE_SINGLE == adc_mode)
+    {
+        /* Đọc R[0] cũng xóa COCO */
+        adc_conv_sum += IP_ADC0->R[0];
+        adc_conv_remaining--;
+
+        if (adc_conv_remaining > 0)
+        {
+            /* Oversampling: bắt đầu lần chuyển đổi kế tiếp ngay trong ngắt */
+            IP_ADC0->SC1[0] = ADC_SC1_ADCH(adc_conv_channel) | ADC_SC1_AIEN_MASK;
+        }
+        else
+        {
+            value = (uint16_t)(adc_conv_sum >> adc_profile->oversample_bits);
+
+            /* Tắt AIEN để SC1[0] trở lại như sau ADC_Init() */
+            IP_ADC0->SC1[0] = ADC_SC1_ADCH_MASK;
+
+            /* Trả ADC về trạng thái rảnh trước, callback có thể bắt đầu lần chuyển đổi kế tiếp */
+            adc_mode = ADC_MODE_IDLE;
+            callback(adc_conv_channel, value);
+        }
+    }
+    else if ((ADC_MODE_SCAN == adc_mode) && (NULL != buffer))
+    {
+        head = buffer->head;
+
+        for (uint8_t i = 0; i < count; i++)
+        {
+            buffer->samples[(i * buffer->depth) + head] = (uint16_t)IP_ADC0->R[i];
+        }
+
+        buffer->head = ((head + 1U) < buffer->depth) ? (head + 1U) : 0U;
+        buffer->count++;
+        adc_scan_busy = (IP_PDB0->SC & PDB_SC_CONT_MASK) ? 1 : 0;
+    }
+    else
+    {
+        /* Không có nhóm quét, đọc R[0] để xóa COCO */
+        (void)IP_ADC0->R[0];
+    }
+}
+
+/**
+ * @brief  Ngắt của eDMA kênh 0, xảy ra ở nửa và ở cuối bộ đệm.
+ * @details Sau ngắt nửa, DMA đang ghi khối thứ hai nên CITER không lớn hơn block_len.
+ * Sau ngắt cuối vòng, CITER đã được nạp lại từ BITER và DMA đang ghi khối thứ nhất.
+ */
+void DMA0_IRQHandler(void)
+{
+    const uint16_t *block = adc_stream_buffer;
+    uint16_t block_len = adc_stream_block_len;
+
+    IP_DMA->CINT = DMA_CINT_CINT(ADC_DMA_CHANNEL);
+
+    if ((IP_DMA->TCD[ADC_DMA_CHANNEL].CITER.ELINKNO & DMA_TCD_CITER_ELINKNO_CITER_MASK) > block_len)
+    {
+        /* Khối thứ hai (pong) vừa đầy */
+        block += block_len;
+    }
+
+    if (NULL != adc_stream_callback)
+    {
+        adc_stream_callback(block, block_len);
+    }
+}
+
+/**
+ * @brief  Ngắt lỗi trình tự của PDB0: trigger mới đến khi ADC chưa xong mẫu hoặc nhóm trước.
+ * @details Cờ ERR phải được xóa thì PDB mới tiếp tục phát pre-trigger.
+ */
+void PDB0_IRQHandler(void)
+{
+    for (uint8_t ch = 0; ch < PDB_CH_COUNT; ch++)
+    {
+        if (IP_PDB0->CH[ch].S & PDB_S_ERR_MASK)
+        {
+            IP_PDB0->CH[ch].S &= ~PDB_S_ERR_MASK;
+            adc_overruns++;
+        }
+    }
 }
@@ -1,8 +1,13 @@
 /**
  * @file adc.h
  * @brief Cung cấp thư viện cấu hình và sử dụng adc cơ bản.
- * @details Thư viện cấu hình adc sử dụng clock SPLL, sử dụng 8-bit phân giải, có hỗ trợ hiệu chỉnh thống số
+ * @details Thư viện cấu hình adc sử dụng clock SPLL, có hỗ trợ hiệu chỉnh thống số
  * trước khi hoạt động và kích hoạt chu tình lấy mẫu bằng phần mềm.
+ * Độ phân giải (8/10/12-bit), trung bình phần cứng, thời gian lấy mẫu và oversampling
+ * phần mềm được chọn theo profile, kèm hệ số đổi sang mV dạng fixed-point.
+ * Hiệu chuẩn và chuyển đổi có thể chạy không chặn, kết quả được báo qua ngắt ADC0.
+ * Chế độ streaming dùng PDB0 làm nhịp lấy mẫu và eDMA chép kết quả vào bộ đệm ping-pong.
+ * Nhóm quét dùng tối đa 16 cặp SC1/R để lấy mẫu nhiều kênh cùng lúc bằng một trigger.
  *
  * @author Nguyen Vuong Trung Nam
  * @date Oct 1, 2025
@@ -11,24 +16,280 @@
 #ifndef ADC_H_
 #define ADC_H_
 
+#include "stddef.h"
 #include "S32K144.h"
+#include "hal_irq.h"
+#include "time_base.h"
 
 
 #define ADC_SUCCESS     0
 #define ADC_INIT_FAIL   1
+#define ADC_PARAM_FAIL  2
+#define ADC_BUSY        3
+#define ADC_CAL_PENDING 4
 
 /**
- * @brief Khởi tạo, hiệu chuẩn và cấu hình ADC0 cho chế độ 8-bit.
- * @note  Hàm này nên được gọi một lần duy nhất khi khởi động hệ thống.
+ * @brief Thời gian chờ tối đa (us) cho hiệu chuẩn và cho một lần chuyển đổi,
+ * đo bằng time_base nên không phụ thuộc tần số CPU.
+ */
+#define ADC_CAL_TIMEOUT_US      10000U
+#define ADC_CONV_TIMEOUT_US     1000U
+
+/**
+ * @brief Giá trị trả về của ADC_Read_Channel() khi chuyển đổi không hoàn tất đúng hạn,
+ * nằm ngoài dải kết quả (tối đa 15-bit khi oversampling).
+ */
+#define ADC_READ_TIMEOUT        0xFFFFU
+
+/**
+ * @brief Điện áp tham chiếu VREFH (mV) của board, tương ứng với giá trị lớn nhất của ADC.
+ */
+#define ADC_VREF_MV             5000U
+
+/**
+ * @brief Số bit tăng thêm tối đa của oversampling phần mềm (4^3 = 64 mẫu cho mỗi kết quả).
+ */
+#define ADC_MAX_OVERSAMPLE_BITS 3U
+
+/**
+ * @brief Độ phân giải, giá trị trùng với trường MODE của CFG1.
+ */
+typedef enum
+{
+    ADC_RES_8BIT  = 0,
+    ADC_RES_12BIT = 1,
+    ADC_RES_10BIT = 2
+} ADC_Resolution_t;
+
+/**
+ * @brief Trung bình phần cứng (SC3 AVGE/AVGS), ADC tự lấy nhiều mẫu cho mỗi kết quả.
+ */
+typedef enum
+{
+    ADC_HWAVG_NONE = 0,
+    ADC_HWAVG_4,
+    ADC_HWAVG_8,
+    ADC_HWAVG_16,
+    ADC_HWAVG_32
+} ADC_HwAverage_t;
+
+/**
+ * @brief Profile lấy mẫu, đổi độ trễ lấy nhiễu thấp hơn.
+ * @details Số bit của kết quả bằng số bit của độ phân giải cộng oversample_bits.
+ * Với oversampling, mỗi kết quả là tổng của 4^n lần chuyển đổi dịch phải n bit (decimation).
+ */
+typedef struct
+{
+    ADC_Resolution_t resolution;    /* Độ phân giải của ADC */
+    ADC_HwAverage_t hw_average;     /* Số mẫu trung bình phần cứng */
+    uint8_t sample_time;            /* CFG2 SMPLTS, thời gian lấy mẫu là (SMPLTS + 1) chu kỳ ADCK */
+    uint8_t oversample_bits;        /* Số bit tăng thêm bằng oversampling phần mềm, 0 đến ADC_MAX_OVERSAMPLE_BITS */
+} ADC_Profile_t;
+
+/**
+ * @brief Các profile có sẵn.
+ * - ADC_ProfileFast: 8-bit, không trung bình, như cấu hình mặc định sau ADC_Init().
+ * - ADC_ProfileBalanced: 12-bit, trung bình phần cứng 4 mẫu.
+ * - ADC_ProfilePrecise: 12-bit, trung bình phần cứng 16 mẫu, thời gian lấy mẫu dài,
+ *   oversampling thêm 2 bit (kết quả 14-bit).
+ */
+extern const ADC_Profile_t ADC_ProfileFast;
+extern const ADC_Profile_t ADC_ProfileBalanced;
+extern const ADC_Profile_t ADC_ProfilePrecise;
+
+/**
+ * @brief Hàm nhận kết quả của ADC_StartConversion(), chạy trong ngữ cảnh ngắt ADC0.
+ * @param[in] channel Kênh vừa chuyển đổi.
+ * @param[in] value Kết quả chuyển đổi.
+ */
+typedef void (*ADC_ConversionCallback_t)(uint8_t channel, uint16_t value);
+
+/**
+ * @brief Khởi tạo, hiệu chuẩn và cấu hình ADC0 theo profile hiện tại, chờ đến khi hiệu chuẩn xong.
+ * @note  Hàm này nên được gọi một lần duy nhất khi khởi động hệ thống, sau time_init().
  * @return ADC_SUCCESS nếu thành công, ADC_INIT_FAIL nếu hiệu chuẩn thất bại.
  */
 uint8_t ADC_Init(void);
 
+/**
+ * @brief Cấp clock cho ADC0 và bắt đầu hiệu chuẩn, trả về ngay không chờ.
+ * @details Dùng cùng ADC_PollCalibration() thay cho ADC_Init() để CPU khởi tạo các
+ * module khác trong lúc ADC hiệu chuẩn.
+ * @note  Phải gọi sau time_init().
+ * @return ADC_SUCCESS nếu đã bắt đầu, ADC_BUSY nếu ADC đang được sử dụng.
+ */
+uint8_t ADC_StartCalibration(void);
+
+/**
+ * @brief Kiểm tra tiến trình hiệu chuẩn, không chặn.
+ * @details Khi hiệu chuẩn xong, hàm cấu hình ADC0 cho hoạt động bình thường như ADC_Init().
+ * Hiệu chuẩn thất bại nếu cờ CAL chưa được xóa khi COCO báo xong (ADC0 của S32K144
+ * không có cờ CALF) hoặc nếu quá ADC_CAL_TIMEOUT_US.
+ * @return
+ * - ADC_CAL_PENDING: Nếu hiệu chuẩn chưa xong.
+ * - ADC_SUCCESS: Nếu hiệu chuẩn thành công, ADC sẵn sàng.
+ * - ADC_INIT_FAIL: Nếu hiệu chuẩn thất bại, quá thời gian hoặc chưa được bắt đầu.
+ */
+uint8_t ADC_PollCalibration(void);
+
+/**
+ * @brief Bắt đầu một lần chuyển đổi và trả về ngay, kết quả được gửi tới callback trong ngắt ADC0.
+ * @note Callback có thể gọi lại ADC_StartConversion() để lấy mẫu liên tiếp.
+ * @param[in] channel Số của kênh cần đọc.
+ * @param[in] callback Hàm nhận kết quả.
+ * @return
+ * - ADC_SUCCESS: Nếu đã bắt đầu chuyển đổi.
+ * - ADC_PARAM_FAIL: Nếu callback là NULL.
+ * - ADC_BUSY: Nếu lần chuyển đổi trước chưa xong hoặc ADC đang ở chế độ khác.
+ */
+uint8_t ADC_StartConversion(uint8_t channel, ADC_ConversionCallback_t callback);
+
 /**
  * @brief Đọc giá trị ADC từ một kênh được chỉ định.
  * @param  channel Số của kênh cần đọc (ví dụ: 12 cho ADC0_SE12).
- * @return Giá trị số 10-bit (0-1023) của kênh.
+ * @return Giá trị số của kênh theo số bit của profile (xem ADC_GetResultBits()),
+ * ADC_READ_TIMEOUT nếu quá thời gian chờ.
  */
 uint16_t ADC_Read_Channel(uint8_t channel);
 
+/**
+ * @brief Chọn profile lấy mẫu.
+ * @details Hệ số đổi sang mV (Q16) được tính một lần tại đây cho số bit của profile.
+ * Nếu gọi trước khi hiệu chuẩn xong, profile được áp dụng khi hiệu chuẩn thành công.
+ * @note Streaming và nhóm quét dùng độ phân giải, trung bình phần cứng và thời gian lấy mẫu
+ * của profile, oversampling phần mềm chỉ áp dụng cho ADC_Read_Channel() và ADC_StartConversion().
+ * @param[in] profile Profile cần dùng, phải tồn tại trong suốt thời gian sử dụng.
+ * @return
+ * - ADC_SUCCESS: Nếu thành công.
+ * - ADC_PARAM_FAIL: Nếu profile không hợp lệ.
+ * - ADC_BUSY: Nếu ADC đang được sử dụng.
+ */
+uint8_t ADC_SetProfile(const ADC_Profile_t *profile);
+
+/**
+ * @brief Số bit của kết quả theo profile hiện tại (độ phân giải cộng oversampling).
+ * @return Số bit, từ 8 đến 15.
+ */
+uint8_t ADC_GetResultBits(void);
+
+/**
+ * @brief Đổi kết quả ADC sang mV bằng phép nhân fixed-point Q16, không dùng float.
+ * @param[in] raw Kết quả theo profile hiện tại.
+ * @return Điện áp (mV), làm tròn đến mV gần nhất.
+ */
+uint32_t ADC_ToMillivolts(uint16_t raw);
+
+/**
+ * @brief Tần số clock của PDB0 (bus clock sau Clock_Init_System_SPLL), dùng để tính chu kỳ lấy mẫu.
+ */
+#define ADC_PDB_CLOCK_HZ        40000000U
+
+/**
+ * @brief Kênh eDMA và nguồn DMAMUX của chế độ streaming.
+ * @note Kênh DMA cố định là 0 vì ngắt được xử lý trong DMA0_IRQHandler.
+ */
+#define ADC_DMA_CHANNEL         0U
+#define ADC_DMA_SOURCE_ADC0     42U
+
+/**
+ * @brief Số mẫu tối đa của một khối, CITER của eDMA chỉ có 15 bit và phải chứa hai khối.
+ */
+#define ADC_STREAM_MAX_BLOCK    16383U
+
+/**
+ * @brief Hàm được gọi mỗi khi một nửa bộ đệm ping-pong đã đầy.
+ * @details Hàm chạy trong ngữ cảnh ngắt DMA, trong lúc đó DMA tiếp tục ghi vào nửa còn lại,
+ * vì vậy phải xử lý (hoặc sao chép) khối xong trước khi nửa còn lại đầy.
+ * @param[in] block Con trỏ tới khối mẫu vừa hoàn tất.
+ * @param[in] length Số mẫu trong khối.
+ */
+typedef void (*ADC_BlockCallback_t)(const uint16_t *block, uint16_t length);
+
+/**
+ * @brief Bắt đầu lấy mẫu liên tục một kênh vào bộ đệm ping-pong.
+ * @details PDB0 chạy ở chế độ liên tục làm nguồn nhịp lấy mẫu, mỗi chu kỳ PDB kích hoạt
+ * SC1[0] bằng pre-trigger phần cứng. Khi chuyển đổi xong, ADC gửi yêu cầu DMA và eDMA
+ * chép R[0] vào bộ đệm, CPU không phải xử lý từng mẫu. eDMA báo ngắt ở nửa và ở cuối
+ * bộ đệm (vòng lặp chính tự quay lại đầu), mỗi ngắt gọi callback với khối vừa đầy.
+ * @note Phải gọi sau ADC_Init(). Trong lúc streaming, ADC_Read_Channel() trả về ADC_READ_TIMEOUT.
+ * @param[in] channel Kênh analog cần lấy mẫu.
+ * @param[in] rate_hz Tần số lấy mẫu (Hz), phải nhỏ hơn tốc độ chuyển đổi tối đa của ADC.
+ * @param[out] buffer Bộ đệm chứa ít nhất 2 * block_len mẫu, phải tồn tại trong suốt quá trình streaming.
+ * @param[in] block_len Số mẫu của một khối (1 đến ADC_STREAM_MAX_BLOCK).
+ * @param[in] callback Hàm được gọi khi một khối đầy.
+ * @return
+ * - ADC_SUCCESS: Nếu đã bắt đầu streaming.
+ * - ADC_PARAM_FAIL: Nếu tham số không hợp lệ hoặc tần số không đạt được với PDB.
+ * - ADC_BUSY: Nếu đang streaming.
+ */
+uint8_t ADC_StreamStart(uint8_t channel, uint32_t rate_hz, uint16_t *buffer,
+                        uint16_t block_len, ADC_BlockCallback_t callback);
+
+/**
+ * @brief Dừng streaming và đưa ADC về chế độ kích hoạt bằng phần mềm.
+ */
+void ADC_StreamStop(void);
+
+/**
+ * @brief Số kênh tối đa của một nhóm quét, bằng số cặp SC1/R của ADC0.
+ */
+#define ADC_SCAN_MAX_CHANNELS   16U
+
+/**
+ * @brief Bộ đệm mẫu dạng struct-of-arrays của nhóm quét.
+ * @details Mỗi kênh có một mảng riêng gồm depth mẫu đặt liên tiếp trong samples, mẫu thứ k
+ * của kênh i (theo thứ tự trong nhóm) nằm ở samples[i * depth + k], xem ADC_SCAN_SAMPLE().
+ * Các mẫu cùng chỉ số k thuộc cùng một lần quét. Bộ đệm được ghi vòng.
+ */
+typedef struct
+{
+    uint16_t *samples;          /* Vùng nhớ gồm (số kênh * depth) mẫu */
+    uint16_t depth;             /* Số lần quét lưu được cho mỗi kênh */
+    volatile uint16_t head;     /* Vị trí sẽ ghi lần quét kế tiếp */
+    volatile uint32_t count;    /* Tổng số lần quét đã hoàn tất */
+} ADC_ScanBuffer_t;
+
+/**
+ * @brief Truy cập mẫu thứ k của kênh thứ i trong nhóm.
+ */
+#define ADC_SCAN_SAMPLE(buffer, i, k)   ((buffer)->samples[((i) * (buffer)->depth) + (k)])
+
+/**
+ * @brief Cấu hình một nhóm quét trên các cặp SC1/R và bắt đầu kích hoạt bằng PDB0.
+ * @details Kênh thứ i của nhóm dùng SC1[i]/R[i]. Một trigger của PDB0 chuyển đổi cả nhóm
+ * nối tiếp nhau bằng pre-trigger back-to-back, không cần phần mềm giữa các kênh. Khi kênh cuối
+ * xong, ADC0_IRQHandler chép toàn bộ nhóm vào bộ đệm trong một lần ngắt.
+ * @note Phải gọi sau ADC_Init(). Trong lúc quét, ADC_Read_Channel() trả về ADC_READ_TIMEOUT.
+ * @param[in] channels Danh sách kênh analog theo thứ tự chuyển đổi.
+ * @param[in] count Số kênh (1 đến ADC_SCAN_MAX_CHANNELS).
+ * @param[in,out] buffer Bộ đệm đã gán samples và depth, phải tồn tại trong suốt quá trình quét.
+ * @param[in] rate_hz Tần số quét (Hz) do PDB0 tạo ra, 0 để chỉ quét khi gọi ADC_ScanTrigger().
+ * @return
+ * - ADC_SUCCESS: Nếu cấu hình thành công.
+ * - ADC_PARAM_FAIL: Nếu tham số không hợp lệ hoặc tần số không đạt được với PDB.
+ * - ADC_BUSY: Nếu ADC đang streaming hoặc đang quét.
+ */
+uint8_t ADC_ScanStart(const uint8_t *channels, uint8_t count, ADC_ScanBuffer_t *buffer, uint32_t rate_hz);
+
+/**
+ * @brief Kích hoạt một lần quét cả nhóm bằng software trigger của PDB0.
+ * @return
+ * - ADC_SUCCESS: Nếu đã kích hoạt.
+ * - ADC_BUSY: Nếu lần quét trước chưa xong.
+ * - ADC_PARAM_FAIL: Nếu chưa có nhóm quét hoặc nhóm đang quét theo tần số.
+ */
+uint8_t ADC_ScanTrigger(void);
+
+/**
+ * @brief Dừng nhóm quét và đưa ADC về chế độ kích hoạt bằng phần mềm.
+ */
+void ADC_ScanStop(void);
+
+/**
+ * @brief Đọc số lỗi trình tự (sequence error) của PDB, mỗi lỗi là một mẫu (hoặc một lần quét)
+ * bị mất do trigger mới đến khi chuyển đổi trước chưa xong hoặc kết quả chưa được lấy đi.
+ * @return Số lỗi từ lần ADC_StreamStart() hoặc ADC_ScanStart() gần nhất.
+ */
+uint32_t ADC_GetOverruns(void);
+
 #endif /* ADC_H_ */
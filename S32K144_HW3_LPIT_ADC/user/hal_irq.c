@@ -0,0 +1,124 @@
+/**
+ * @file hal_irq.c
+ * @author benecosta2711
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include "hal_irq.h"
+#include "my_nvic.h"
+#include "S32K144_features.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/**
+ * @brief One entry of the priority table, a range of consecutive interrupt numbers.
+ */
+typedef struct
+{
+    IRQn_Type first;
+    IRQn_Type last;
+    uint8_t priority;
+} hal_irq_priority_t;
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+/**
+ * @brief Priority of every interrupt used by the project.
+ */
+static const hal_irq_priority_t s_irqPriorityTable[] = {
+    { ADC0_IRQn,         ADC0_IRQn,         HAL_IRQ_PRIO_ADC   },
+    { DMA0_IRQn,         DMA0_IRQn,         HAL_IRQ_PRIO_ADC   },
+    { PDB0_IRQn,         PDB0_IRQn,         HAL_IRQ_PRIO_ADC   },
+    { LPIT0_Ch0_IRQn,    LPIT0_Ch3_IRQn,    HAL_IRQ_PRIO_TIMER },
+};
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+void HAL_IRQ_SetPriorityGrouping(uint32_t grouping)
+{
+    uint32_t aircr = 0U;
+
+    if (grouping <= (S32_SCB_AIRCR_PRIGROUP_MASK >> S32_SCB_AIRCR_PRIGROUP_SHIFT))
+    {
+        /* AIRCR ignores a write without the key, the key reads back as VECTKEYSTAT so it is cleared first */
+        aircr = S32_SCB->AIRCR & ~(S32_SCB_AIRCR_VECTKEY_MASK | S32_SCB_AIRCR_PRIGROUP_MASK);
+        S32_SCB->AIRCR = aircr | S32_SCB_AIRCR_VECTKEY(FEATURE_SCB_VECTKEY) | S32_SCB_AIRCR_PRIGROUP(grouping);
+    }
+    else
+    {
+        /* Do nothing */
+    }
+}
+
+void HAL_IRQ_SetPriority(IRQn_Type irq, uint32_t priority)
+{
+    if ((irq >= 0) && (priority <= HAL_IRQ_PRIO_LOWEST))
+    {
+        /* Implemented bits are the most significant bits of the byte */
+        NVIC->IP[(uint32_t)irq] = (uint8_t)(priority << (8U - HAL_IRQ_PRIO_BITS));
+    }
+    else
+    {
+        /* Do nothing */
+    }
+}
+
+uint32_t HAL_IRQ_GetTablePriority(IRQn_Type irq)
+{
+    uint32_t priority = HAL_IRQ_PRIO_LOWEST;
+    uint32_t i = 0U;
+
+    for (i = 0U; i < (sizeof(s_irqPriorityTable) / sizeof(s_irqPriorityTable[0])); i++)
+    {
+        if ((irq >= s_irqPriorityTable[i].first) && (irq <= s_irqPriorityTable[i].last))
+        {
+            priority = s_irqPriorityTable[i].priority;
+            break;
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }
+
+    return priority;
+}
+
+void HAL_IRQ_Enable(IRQn_Type irq)
+{
+    if (irq >= 0)
+    {
+        /* Priority is written before the interrupt can be taken */
+        HAL_IRQ_SetPriority(irq, HAL_IRQ_GetTablePriority(irq));
+        NVIC->ISER[(uint32_t)irq >> 5U] = (1UL << ((uint32_t)irq & 0x1FUL));
+    }
+    else
+    {
+        /* Do nothing, system exceptions are not handled by the NVIC */
+    }
+}
+
+void HAL_IRQ_Disable(IRQn_Type irq)
+{
+    if (irq >= 0)
+    {
+        NVIC->ICER[(uint32_t)irq >> 5U] = (1UL << ((uint32_t)irq & 0x1FUL));
+
+        /* The disable takes effect before the caller touches the data of the ISR */
+        __asm volatile ("dsb\n isb" : : : "memory");
+    }
+    else
+    {
+        /* Do nothing */
+    }
+}
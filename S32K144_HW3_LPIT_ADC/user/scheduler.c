@@ -0,0 +1,174 @@
+/**
+ * @file scheduler.c
+ * @brief File triển khai bộ lập lịch hợp tác.
+ * @details Bảng task tĩnh, mỗi phần tử lưu deadline tuyệt đối của lần chạy kế tiếp.
+ * Mọi phép so sánh thời gian dùng hiệu có dấu để an toàn khi bộ đếm tick bị tràn.
+ *
+ * @author Nguyen Vuong Trung Nam
+ * @date Oct 17, 2026
+ */
+
+#include "scheduler.h"
+
+/**
+ * @brief Thông tin của một task trong bảng.
+ */
+typedef struct
+{
+    SCH_Task_t task;
+    uint32_t period;
+    uint32_t next_run;
+    uint8_t priority;
+    SCH_TaskStats_t stats;
+} SCH_TaskControl_t;
+
+static SCH_TaskControl_t sch_tasks[SCH_MAX_TASKS];
+static uint8_t sch_task_count = 0;
+
+/**
+ * @brief Chọn task đến hạn có mức ưu tiên cao nhất.
+ * @details Khi cùng mức ưu tiên, task có deadline sớm hơn được chọn trước.
+ * @param[in] now Tick hiện tại.
+ * @return uint8_t Chỉ số task, SCH_INVALID_ID nếu không có task nào đến hạn.
+ */
+static uint8_t SCH_FindReady(uint32_t now)
+{
+    uint8_t selected = SCH_INVALID_ID;
+
+    for (uint8_t i = 0; i < sch_task_count; i++)
+    {
+        if ((int32_t)(now - sch_tasks[i].next_run) >= 0)
+        {
+            if ((SCH_INVALID_ID == selected)
+                || (sch_tasks[i].priority < sch_tasks[selected].priority)
+                || ((sch_tasks[i].priority == sch_tasks[selected].priority)
+                    && ((int32_t)(sch_tasks[i].next_run - sch_tasks[selected].next_run) < 0)))
+            {
+                selected = i;
+            }
+            else
+            {
+                /* Do nothing */
+            }
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }
+
+    return selected;
+}
+
+/**
+ * @brief Khởi tạo bộ lập lịch.
+ * @copydoc SCH_Init
+ */
+void SCH_Init(void)
+{
+    for (uint8_t i = 0; i < SCH_MAX_TASKS; i++)
+    {
+        sch_tasks[i].task = NULL;
+        sch_tasks[i].period = 0;
+        sch_tasks[i].next_run = 0;
+        sch_tasks[i].priority = 0;
+        sch_tasks[i].stats.run_count = 0;
+        sch_tasks[i].stats.overrun_count = 0;
+        sch_tasks[i].stats.last_jitter = 0;
+        sch_tasks[i].stats.max_jitter = 0;
+    }
+
+    sch_task_count = 0;
+
+}
+
+/**
+ * @brief Đăng ký một task định kỳ.
+ * @copydoc SCH_AddTask
+ */
+uint8_t SCH_AddTask(SCH_Task_t task, uint32_t period_ms, uint32_t offset_ms, uint8_t priority)
+{
+    uint8_t id = SCH_INVALID_ID;
+
+    if ((NULL != task) && (0 != period_ms) && (sch_task_count < SCH_MAX_TASKS))
+    {
+        id = sch_task_count;
+
+        sch_tasks[id].task = task;
+        sch_tasks[id].period = period_ms;
+        sch_tasks[id].next_run = TIM_GetTick() + offset_ms;
+        sch_tasks[id].priority = priority;
+
+        sch_task_count++;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+
+    return id;
+
+}
+
+/**
+ * @brief Chạy tất cả các task đã đến hạn.
+ * @copydoc SCH_Dispatch
+ */
+void SCH_Dispatch(void)
+{
+    uint32_t now = TIM_GetTick();
+    uint8_t id = SCH_FindReady(now);
+    uint32_t late = 0;
+    uint32_t missed = 0;
+    SCH_TaskControl_t *tcb = NULL;
+
+    while (SCH_INVALID_ID != id)
+    {
+        tcb = &sch_tasks[id];
+
+        /* Jitter: độ trễ giữa deadline và thời điểm task thực sự bắt đầu */
+        late = now - tcb->next_run;
+        tcb->stats.last_jitter = late;
+        if (late > tcb->stats.max_jitter)
+        {
+            tcb->stats.max_jitter = late;
+        }
+        else
+        {
+            /* Do nothing */
+        }
+
+        /*
+         * Deadline tuyệt đối: cộng chu kỳ vào deadline cũ chứ không phải vào 'now'.
+         * Nếu trễ từ một chu kỳ trở lên thì các lần chạy bị lỡ được bỏ qua
+         * (không chạy bù) và tính là overrun, nhưng vẫn giữ đúng pha ban đầu.
+         */
+        missed = late / tcb->period;
+        tcb->stats.overrun_count += missed;
+        tcb->next_run += (missed + 1) * tcb->period;
+
+        tcb->task();
+        tcb->stats.run_count++;
+
+        now = TIM_GetTick();
+        id = SCH_FindReady(now);
+    }
+
+}
+
+/**
+ * @brief Đọc thống kê của một task.
+ * @copydoc SCH_GetStats
+ */
+uint8_t SCH_GetStats(uint8_t id, SCH_TaskStats_t *stats)
+{
+    if ((id >= sch_task_count) || (NULL == stats))
+    {
+        return 0;
+    }
+
+    *stats = sch_tasks[id].stats;
+
+    return 1;
+
+}
@@ -0,0 +1,80 @@
+/**
+ * @file scheduler.h
+ * @brief Bộ lập lịch hợp tác (cooperative, run-to-completion) dựa trên software timer.
+ * @details Mỗi task được đăng ký với chu kỳ, độ lệch (offset) và mức ưu tiên.
+ * Thời điểm chạy kế tiếp được tính tuyệt đối (next = next + period) nên task
+ * định kỳ không bị trôi theo độ trễ của vòng lặp chính. Bộ lập lịch cũng ghi
+ * lại số lần overrun và jitter của từng task.
+ *
+ * @author Nguyen Vuong Trung Nam
+ * @date Oct 17, 2026
+ */
+
+#ifndef SCHEDULER_H_
+#define SCHEDULER_H_
+
+#include "stdint.h"
+#include "stddef.h"
+#include "software_timer.h"
+
+#define SCH_MAX_TASKS       8U
+#define SCH_INVALID_ID      0xFFU
+
+/**
+ * @brief Kiểu hàm của một task, chạy đến khi kết thúc và không được chặn (block).
+ */
+typedef void (*SCH_Task_t)(void);
+
+/**
+ * @brief Thống kê thời gian chạy của một task.
+ */
+typedef struct
+{
+    uint32_t run_count;         /* Số lần task đã chạy */
+    uint32_t overrun_count;     /* Số chu kỳ bị bỏ lỡ do task chạy trễ quá một chu kỳ */
+    uint32_t last_jitter;       /* Độ trễ (ms) so với deadline ở lần chạy gần nhất */
+    uint32_t max_jitter;        /* Độ trễ lớn nhất (ms) đã ghi nhận */
+} SCH_TaskStats_t;
+
+/**
+ * @brief Khởi tạo bộ lập lịch, xóa toàn bộ bảng task.
+ * @note Phải gọi sau TIM_Init() vì bộ lập lịch dùng TIM_GetTick() làm mốc thời gian.
+ * @param None
+ * @return None
+ */
+void SCH_Init(void);
+
+/**
+ * @brief Đăng ký một task định kỳ.
+ * @param[in] task Hàm của task.
+ * @param[in] period_ms Chu kỳ chạy (ms), phải lớn hơn 0.
+ * @param[in] offset_ms Thời gian chờ (ms) tính từ lúc đăng ký đến lần chạy đầu tiên,
+ * dùng để dàn trải các task có cùng chu kỳ.
+ * @param[in] priority Mức ưu tiên, 0 là cao nhất. Khi nhiều task cùng đến hạn,
+ * task có mức ưu tiên cao hơn được chạy trước.
+ * @return uint8_t
+ * - Chỉ số của task (0 đến SCH_MAX_TASKS - 1) nếu thành công.
+ * - SCH_INVALID_ID nếu tham số không hợp lệ hoặc bảng task đã đầy.
+ */
+uint8_t SCH_AddTask(SCH_Task_t task, uint32_t period_ms, uint32_t offset_ms, uint8_t priority);
+
+/**
+ * @brief Chạy tất cả các task đã đến hạn.
+ * @note Hàm này được gọi liên tục trong vòng lặp chính. Mỗi lượt chọn task đến hạn
+ * có mức ưu tiên cao nhất, chạy nó rồi chọn lại, cho đến khi không còn task nào đến hạn.
+ * @param None
+ * @return None
+ */
+void SCH_Dispatch(void);
+
+/**
+ * @brief Đọc thống kê của một task.
+ * @param[in] id Chỉ số của task trả về từ SCH_AddTask().
+ * @param[out] stats Nơi lưu thống kê.
+ * @return uint8_t
+ * - 1: Nếu đọc thành công.
+ * - 0: Nếu chỉ số không hợp lệ.
+ */
+uint8_t SCH_GetStats(uint8_t id, SCH_TaskStats_t *stats);
+
+#endif /* SCHEDULER_H_ */
@@ -0,0 +1,182 @@
+/**
+ * @file sig_cond.c
+ * @brief File triển khai thư viện sig_cond.h.
+ * @details Không dùng phép chia trong các hàm cập nhật ngoài phép chia cho độ dài cửa sổ
+ * của bộ lọc trung bình trượt, không dùng float.
+ *
+ * @author Nguyen Vuong Trung Nam
+ * @date Oct 17, 2026
+ */
+
+#include "sig_cond.h"
+
+#define SIG_IIR_FRAC_BITS       8U
+/* Phần dư bị bỏ khi dịch nhỏ hơn nửa LSB của đầu ra, nên đầu ra về đúng giá trị đầu vào */
+#define SIG_IIR_MAX_SHIFT       (SIG_IIR_FRAC_BITS - 1U)
+
+/**
+ * @brief Khởi tạo bộ lọc trung bình trượt.
+ * @copydoc SIG_MovAvgInit
+ */
+uint8_t SIG_MovAvgInit(SIG_MovAvg_t *filter, uint16_t *window, uint8_t length)
+{
+    if ((NULL == filter) || (NULL == window) || (0 == length) || (length > SIG_MOVAVG_MAX_LENGTH))
+    {
+        return 0;
+    }
+
+    filter->window = window;
+    filter->sum = 0;
+    filter->length = length;
+    filter->index = 0;
+    filter->filled = 0;
+
+    return 1;
+
+}
+
+/**
+ * @brief Đưa một mẫu vào bộ lọc trung bình trượt.
+ * @copydoc SIG_MovAvgUpdate
+ */
+uint16_t SIG_MovAvgUpdate(SIG_MovAvg_t *filter, uint16_t sample)
+{
+    /* Bỏ mẫu cũ nhất ra khỏi tổng khi cửa sổ đã đầy, tổng tối đa 64 * 65535 không tràn */
+    if (filter->filled == filter->length)
+    {
+        filter->sum -= filter->window[filter->index];
+    }
+    else
+    {
+        filter->filled++;
+    }
+
+    filter->window[filter->index] = sample;
+    filter->sum += sample;
+
+    filter->index++;
+    if (filter->index >= filter->length)
+    {
+        filter->index = 0;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+
+    return (uint16_t)((filter->sum + (filter->filled / 2U)) / filter->filled);
+
+}
+
+/**
+ * @brief Khởi tạo bộ lọc IIR bậc một.
+ * @copydoc SIG_IirInit
+ */
+uint8_t SIG_IirInit(SIG_Iir_t *filter, uint8_t shift)
+{
+    if ((NULL == filter) || (shift > SIG_IIR_MAX_SHIFT))
+    {
+        return 0;
+    }
+
+    filter->state = 0;
+    filter->shift = shift;
+    filter->primed = 0;
+
+    return 1;
+
+}
+
+/**
+ * @brief Đưa một mẫu vào bộ lọc IIR.
+ * @copydoc SIG_IirUpdate
+ */
+uint16_t SIG_IirUpdate(SIG_Iir_t *filter, uint16_t sample)
+{
+    uint32_t input = (uint32_t)sample << SIG_IIR_FRAC_BITS;
+
+    if (!filter->primed)
+    {
+        filter->state = input;
+        filter->primed = 1;
+    }
+    else
+    {
+        /* Tính trên số có dấu, dịch phải số âm ở đây là dịch số học trên Cortex-M4 */
+        filter->state = (uint32_t)((int32_t)filter->state
+                      + (((int32_t)input - (int32_t)filter->state) >> filter->shift));
+    }
+
+    return (uint16_t)((filter->state + (1U << (SIG_IIR_FRAC_BITS - 1U))) >> SIG_IIR_FRAC_BITS);
+
+}
+
+/**
+ * @brief Khởi tạo bộ phân loại băng.
+ * @copydoc SIG_ClassifierInit
+ */
+uint8_t SIG_ClassifierInit(SIG_Classifier_t *classifier, const uint32_t *thresholds,
+                           uint8_t band_count, uint32_t hysteresis)
+{
+    if ((NULL == classifier) || (NULL == thresholds) || (band_count < 2) || (band_count > SIG_MAX_BANDS))
+    {
+        return 0;
+    }
+
+    /* Bảng ngưỡng phải tăng dần */
+    for (uint8_t i = 1; i < (band_count - 1U); i++)
+    {
+        if (thresholds[i] <= thresholds[i - 1U])
+        {
+            return 0;
+        }
+    }
+
+    classifier->thresholds = thresholds;
+    classifier->band_count = band_count;
+    classifier->hysteresis = hysteresis;
+    classifier->current = SIG_BAND_NONE;
+
+    return 1;
+
+}
+
+/**
+ * @brief Phân loại một giá trị.
+ * @copydoc SIG_Classify
+ */
+uint8_t SIG_Classify(SIG_Classifier_t *classifier, uint32_t value)
+{
+    const uint32_t *thresholds = classifier->thresholds;
+    uint8_t band = classifier->current;
+
+    if (SIG_BAND_NONE == band)
+    {
+        /* Lần đầu: băng chứa giá trị, không áp dụng độ trễ */
+        band = 0;
+        while (((band + 1U) < classifier->band_count) && (value >= thresholds[band]))
+        {
+            band++;
+        }
+    }
+    else
+    {
+        /* Đi lên khi vượt ngưỡng trên cộng độ trễ */
+        while (((band + 1U) < classifier->band_count)
+               && (value >= (thresholds[band] + classifier->hysteresis)))
+        {
+            band++;
+        }
+
+        /* Đi xuống khi thấp hơn ngưỡng dưới trừ độ trễ, so sánh dạng cộng để không tràn dưới */
+        while ((band > 0) && ((value + classifier->hysteresis) < thresholds[band - 1U]))
+        {
+            band--;
+        }
+    }
+
+    classifier->current = band;
+
+    return band;
+
+}
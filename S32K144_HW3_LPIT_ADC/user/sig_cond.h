@@ -0,0 +1,140 @@
+/**
+ * @file sig_cond.h
+ * @brief Thư viện xử lý tín hiệu số nguyên cho kết quả ADC.
+ * @details Gồm hệ số tỉ lệ dạng Q16 được tính lúc biên dịch, bộ lọc trung bình trượt và
+ * bộ lọc IIR bậc một, bộ phân loại theo bảng ngưỡng có trễ (hysteresis) để tránh nhấp nháy
+ * khi giá trị nằm sát ngưỡng. Mọi hàm chỉ dùng số nguyên và có số bước giới hạn.
+ *
+ * @author Nguyen Vuong Trung Nam
+ * @date Oct 17, 2026
+ */
+
+#ifndef SIG_COND_H_
+#define SIG_COND_H_
+
+#include "stdint.h"
+#include "stddef.h"
+
+/**
+ * @brief Tạo hệ số Q16 của phân số num / den, làm tròn đến gần nhất.
+ * @note Khi tham số là hằng số, trình biên dịch tính sẵn kết quả, không tốn chu kỳ lúc chạy.
+ */
+#define SIG_Q16(num, den)           (((((uint32_t)(num)) << 16) + (((uint32_t)(den)) / 2U)) / ((uint32_t)(den)))
+
+/**
+ * @brief Nhân một giá trị với hệ số Q16, làm tròn đến gần nhất.
+ * @note Người gọi phải đảm bảo x * q không vượt quá 32 bit.
+ */
+#define SIG_Q16_MUL(x, q)           (((((uint32_t)(x)) * ((uint32_t)(q))) + 0x8000U) >> 16)
+
+/**
+ * @brief Số phần tử tối đa của cửa sổ trung bình trượt.
+ */
+#define SIG_MOVAVG_MAX_LENGTH       64U
+
+/**
+ * @brief Số băng tối đa của bộ phân loại.
+ */
+#define SIG_MAX_BANDS               16U
+
+/**
+ * @brief Bộ lọc trung bình trượt, tổng được cập nhật tăng dần nên mỗi mẫu chỉ tốn O(1).
+ */
+typedef struct
+{
+    uint16_t *window;       /* Bộ đệm của cửa sổ, do người dùng cấp */
+    uint32_t sum;           /* Tổng các mẫu trong cửa sổ */
+    uint8_t length;         /* Số phần tử của cửa sổ */
+    uint8_t index;          /* Vị trí sẽ ghi mẫu kế tiếp */
+    uint8_t filled;         /* Số mẫu đã có trong cửa sổ */
+} SIG_MovAvg_t;
+
+/**
+ * @brief Bộ lọc IIR bậc một (trung bình hàm mũ): y += (x - y) / 2^shift.
+ * @details Trạng thái được lưu với 8 bit phần lẻ để không mất độ chính xác khi dịch.
+ */
+typedef struct
+{
+    uint32_t state;         /* Giá trị đầu ra dạng Q8 */
+    uint8_t shift;          /* Hệ số lọc, càng lớn càng mượt và càng chậm */
+    uint8_t primed;         /* 0 cho đến khi nhận mẫu đầu tiên */
+} SIG_Iir_t;
+
+/**
+ * @brief Bộ phân loại băng có trễ.
+ * @details Bảng thresholds gồm (band_count - 1) ngưỡng tăng dần, băng i gồm các giá trị
+ * thresholds[i - 1] <= x < thresholds[i]. Khi đã ở băng i, giá trị phải vượt ngưỡng
+ * thêm hysteresis mới chuyển sang băng bên cạnh.
+ */
+typedef struct
+{
+    const uint32_t *thresholds; /* Bảng ngưỡng tăng dần */
+    uint8_t band_count;         /* Số băng, bằng số ngưỡng cộng một */
+    uint32_t hysteresis;        /* Độ trễ, cùng đơn vị với giá trị đầu vào */
+    uint8_t current;            /* Băng hiện tại, SIG_BAND_NONE trước lần phân loại đầu tiên */
+} SIG_Classifier_t;
+
+#define SIG_BAND_NONE               0xFFU
+
+/**
+ * @brief Khởi tạo bộ lọc trung bình trượt.
+ * @param[out] filter Bộ lọc.
+ * @param[in] window Bộ đệm gồm length phần tử.
+ * @param[in] length Số phần tử của cửa sổ (1 đến SIG_MOVAVG_MAX_LENGTH).
+ * @return uint8_t
+ * - 1: Nếu thành công.
+ * - 0: Nếu tham số không hợp lệ.
+ */
+uint8_t SIG_MovAvgInit(SIG_MovAvg_t *filter, uint16_t *window, uint8_t length);
+
+/**
+ * @brief Đưa một mẫu vào bộ lọc trung bình trượt.
+ * @details Trước khi cửa sổ đầy, kết quả là trung bình của các mẫu đã có.
+ * @param[in,out] filter Bộ lọc.
+ * @param[in] sample Mẫu mới.
+ * @return uint16_t Giá trị trung bình, làm tròn đến gần nhất.
+ */
+uint16_t SIG_MovAvgUpdate(SIG_MovAvg_t *filter, uint16_t sample);
+
+/**
+ * @brief Khởi tạo bộ lọc IIR bậc một.
+ * @param[out] filter Bộ lọc.
+ * @param[in] shift Hệ số lọc (0 đến 7), 0 là không lọc.
+ * @return uint8_t
+ * - 1: Nếu thành công.
+ * - 0: Nếu tham số không hợp lệ.
+ */
+uint8_t SIG_IirInit(SIG_Iir_t *filter, uint8_t shift);
+
+/**
+ * @brief Đưa một mẫu vào bộ lọc IIR, mẫu đầu tiên được dùng làm giá trị ban đầu.
+ * @param[in,out] filter Bộ lọc.
+ * @param[in] sample Mẫu mới (tối đa 16 bit).
+ * @return uint16_t Giá trị sau lọc, làm tròn đến gần nhất.
+ */
+uint16_t SIG_IirUpdate(SIG_Iir_t *filter, uint16_t sample);
+
+/**
+ * @brief Khởi tạo bộ phân loại băng.
+ * @param[out] classifier Bộ phân loại.
+ * @param[in] thresholds Bảng (band_count - 1) ngưỡng tăng dần, phải tồn tại trong suốt thời gian sử dụng.
+ * @param[in] band_count Số băng (2 đến SIG_MAX_BANDS).
+ * @param[in] hysteresis Độ trễ ở mỗi ngưỡng.
+ * @return uint8_t
+ * - 1: Nếu thành công.
+ * - 0: Nếu tham số không hợp lệ.
+ */
+uint8_t SIG_ClassifierInit(SIG_Classifier_t *classifier, const uint32_t *thresholds,
+                           uint8_t band_count, uint32_t hysteresis);
+
+/**
+ * @brief Phân loại một giá trị.
+ * @details Lần đầu tiên, giá trị được xếp thẳng vào băng chứa nó. Các lần sau, băng chỉ
+ * thay đổi khi giá trị vượt ngưỡng cộng (hoặc trừ) độ trễ, số bước tối đa bằng số băng.
+ * @param[in,out] classifier Bộ phân loại.
+ * @param[in] value Giá trị cần phân loại.
+ * @return uint8_t Chỉ số băng (0 đến band_count - 1).
+ */
+uint8_t SIG_Classify(SIG_Classifier_t *classifier, uint32_t value);
+
+#endif /* SIG_COND_H_ */
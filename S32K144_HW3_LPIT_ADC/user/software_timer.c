@@ -10,31 +10,362 @@
 
 #include "software_timer.h"
 
-#define MAX_SOFTWARE_TIMERS   10
+/* Giá trị đánh dấu timer không nằm trong heap */
+#define TIM_NOT_QUEUED      0xFFFFU
 
+/* Kênh LPIT tạo ngắt, kênh 2 và 3 thuộc về time_base */
+#define TIM_ALARM_CHANNEL       0U
 
-volatile uint32_t timer_counter[MAX_SOFTWARE_TIMERS];
-volatile uint8_t timer_flag[MAX_SOFTWARE_TIMERS];
+/* Khoảng nạp ngắn nhất cho kênh 0, tránh nạp giá trị đã trôi qua trong lúc tính toán */
+#define TIM_ALARM_MIN_CYCLES    64U
+
+/* Timer dùng cờ chiếm [0, MAX_SOFTWARE_TIMERS), handle của pool nằm ngay sau */
+#define TIM_TOTAL_TIMERS        (MAX_SOFTWARE_TIMERS + TIM_MAX_HANDLES)
+#define TIM_HANDLE_BASE         MAX_SOFTWARE_TIMERS
+
+/*
+ * Các thao tác trên heap từ vòng lặp chính phải che ngắt LPIT để không xen kẽ với ISR
+ * (BASEPRI ở mức HAL_IRQ_PRIO_CRITICAL, các ngắt ADC ưu tiên cao hơn vẫn chạy).
+ * Có thể lồng nhau và gọi từ một đoạn mã đã ở trong critical section.
+ */
+#define TIM_ENTER_CRITICAL(state)     HAL_IRQ_ENTER_CRITICAL(state)
+#define TIM_EXIT_CRITICAL(state)      HAL_IRQ_EXIT_CRITICAL(state)
+
+/* Deadline tuyệt đối (tick) và chu kỳ (0 = one-shot) của từng timer */
+static uint32_t timer_expiry[TIM_TOTAL_TIMERS];
+static uint32_t timer_period[TIM_TOTAL_TIMERS];
+
+/* Min-heap chỉ số timer theo deadline, timer_pos lưu vị trí của mỗi timer trong heap */
+static uint16_t timer_heap[TIM_TOTAL_TIMERS];
+static uint16_t timer_pos[TIM_TOTAL_TIMERS];
+static uint16_t timer_heap_size = 0;
+
+volatile uint8_t timer_flag[TIM_TOTAL_TIMERS];
+
+/* Callback của các handle, NULL với timer dùng cờ */
+static TIM_Callback_t timer_callback[TIM_TOTAL_TIMERS];
+static void *timer_ctx[TIM_TOTAL_TIMERS];
+static uint8_t timer_deferred[TIM_TOTAL_TIMERS];
+
+/* Pool handle: ngăn xếp các handle còn trống */
+static TIM_Handle_t timer_free_list[TIM_MAX_HANDLES];
+static uint16_t timer_free_count = 0;
+static uint8_t timer_allocated[TIM_MAX_HANDLES];
+
+/*
+ * Danh sách callback chờ dispatch, nối theo thứ tự hết hạn. timer_linked cho biết
+ * handle đang nằm trong danh sách, timer_pending cho biết callback vẫn cần chạy
+ * (bị xóa khi timer dừng hoặc được giải phóng trước lúc dispatch).
+ */
+static uint16_t timer_pending_next[TIM_TOTAL_TIMERS];
+static uint16_t timer_pending_head = TIM_NOT_QUEUED;
+static uint16_t timer_pending_tail = TIM_NOT_QUEUED;
+static uint8_t timer_linked[TIM_TOTAL_TIMERS];
+static volatile uint8_t timer_pending[TIM_TOTAL_TIMERS];
+/*
+ * Tick (ms) dùng để so sánh với deadline. Chế độ tick: tăng 1 sau mỗi ngắt 1ms.
+ * Chế độ tickless: cập nhật từ bộ đếm 64-bit mỗi khi ISR chạy.
+ */
+static volatile uint32_t timer_tick = 0;
+
+/**
+ * @brief Đọc tick (ms) hiện tại.
+ */
+static inline uint32_t TIM_CurrentTick(void)
+{
+#if (TIM_TICKLESS == 1)
+    return (uint32_t)(time_now_cycles() / TIM_CYCLES_PER_MS);
+#else
+    return timer_tick;
+#endif
+}
+
+/**
+ * @brief So sánh deadline của hai timer, an toàn khi bộ đếm tick bị tràn.
+ * @return uint8_t 1 nếu timer a hết hạn trước timer b.
+ */
+static inline uint8_t TIM_IsEarlier(uint16_t a, uint16_t b)
+{
+    return ((int32_t)(timer_expiry[a] - timer_expiry[b]) < 0) ? 1 : 0;
+}
+
+/**
+ * @brief Đặt timer vào vị trí pos của heap và cập nhật bảng vị trí.
+ */
+static inline void TIM_HeapPlace(uint16_t pos, uint16_t index)
+{
+    timer_heap[pos] = index;
+    timer_pos[index] = pos;
+}
+
+/**
+ * @brief Đẩy phần tử tại pos lên trên cho đến khi đúng thứ tự heap.
+ */
+static void TIM_HeapSiftUp(uint16_t pos)
+{
+    uint16_t index = timer_heap[pos];
+    uint16_t parent = 0;
+
+    while (pos > 0)
+    {
+        parent = (uint16_t)((pos - 1) / 2);
+        if (TIM_IsEarlier(index, timer_heap[parent]))
+        {
+            TIM_HeapPlace(pos, timer_heap[parent]);
+            pos = parent;
+        }
+        else
+        {
+            break;
+        }
+    }
+
+    TIM_HeapPlace(pos, index);
+}
+
+/**
+ * @brief Đẩy phần tử tại pos xuống dưới cho đến khi đúng thứ tự heap.
+ */
+static void TIM_HeapSiftDown(uint16_t pos)
+{
+    uint16_t index = timer_heap[pos];
+    uint32_t child = 0;
+
+    while (1)
+    {
+        child = (2U * pos) + 1U;
+        if (child >= timer_heap_size)
+        {
+            break;
+        }
+
+        if (((child + 1U) < timer_heap_size)
+            && TIM_IsEarlier(timer_heap[child + 1U], timer_heap[child]))
+        {
+            child++;
+        }
+
+        if (TIM_IsEarlier(timer_heap[child], index))
+        {
+            TIM_HeapPlace(pos, timer_heap[child]);
+            pos = (uint16_t)child;
+        }
+        else
+        {
+            break;
+        }
+    }
+
+    TIM_HeapPlace(pos, index);
+}
+
+/**
+ * @brief Lấy một timer ra khỏi heap, O(log N).
+ */
+static void TIM_HeapRemove(uint16_t index)
+{
+    uint16_t pos = timer_pos[index];
+    uint16_t last = 0;
+
+    if (TIM_NOT_QUEUED == pos)
+    {
+        return;
+    }
+
+    timer_pos[index] = TIM_NOT_QUEUED;
+    timer_heap_size--;
+
+    if (pos != timer_heap_size)
+    {
+        /* Đưa phần tử cuối vào chỗ trống rồi khôi phục thứ tự theo cả hai chiều */
+        last = timer_heap[timer_heap_size];
+        TIM_HeapPlace(pos, last);
+        TIM_HeapSiftUp(pos);
+        TIM_HeapSiftDown(timer_pos[last]);
+    }
+    else
+    {
+        /* Do nothing */
+    }
+}
+
+/**
+ * @brief Thêm một timer vào heap, O(log N).
+ */
+static void TIM_HeapInsert(uint16_t index)
+{
+    TIM_HeapPlace(timer_heap_size, index);
+    timer_heap_size++;
+    TIM_HeapSiftUp(timer_pos[index]);
+}
+
+#if (TIM_TICKLESS == 1)
+/**
+ * @brief Nạp kênh 0 của LPIT để ngắt đúng vào deadline sớm nhất.
+ * @details Deadline (ms) được đổi sang số chu kỳ còn lại tính từ bộ đếm 64-bit, nên
+ * ngắt xảy ra đúng tại biên ms như ở chế độ tick. Nếu khoảng cách vượt quá 32-bit,
+ * kênh 0 ngắt sớm, ISR không thấy timer nào hết hạn và nạp lại phần còn lại.
+ * Không còn timer nào thì kênh 0 được dừng hẳn.
+ * @note Phải gọi trong ISR hoặc khi đã tắt ngắt.
+ * @param None
+ * @return None
+ */
+static void TIM_ProgramAlarm(void)
+{
+    uint64_t now = 0;
+    uint64_t delta = 0;
+    int32_t diff = 0;
+
+    /* Dừng kênh 0 trước khi nạp TVAL, giá trị mới có hiệu lực khi bật lại */
+    IP_LPIT0->CLRTEN = LPIT_CLRTEN_CLR_T_EN_0_MASK;
+    IP_LPIT0->MSR = LPIT_MSR_TIF0_MASK;
+
+    if (0 == timer_heap_size)
+    {
+        return;
+    }
+
+    now = time_now_cycles();
+    diff = (int32_t)(timer_expiry[timer_heap[0]] - (uint32_t)(now / TIM_CYCLES_PER_MS));
+
+    if (diff <= 0)
+    {
+        delta = TIM_ALARM_MIN_CYCLES;
+    }
+    else
+    {
+        delta = ((uint64_t)diff * TIM_CYCLES_PER_MS) - (now % TIM_CYCLES_PER_MS);
+
+        if (delta > 0xFFFFFFFFUL)
+        {
+            delta = 0xFFFFFFFFUL;
+        }
+        else if (delta < TIM_ALARM_MIN_CYCLES)
+        {
+            delta = TIM_ALARM_MIN_CYCLES;
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }
+
+    /* Kênh đếm từ TVAL về 0, ngắt sau TVAL + 1 chu kỳ */
+    IP_LPIT0->TMR[TIM_ALARM_CHANNEL].TVAL = (uint32_t)delta - 1U;
+    IP_LPIT0->SETTEN = LPIT_SETTEN_SET_T_EN_0_MASK;
+}
+#endif
+
+/**
+ * @brief Xếp callback của một timer vào danh sách chờ dispatch.
+ * @note Gọi trong ISR hoặc khi đã tắt ngắt.
+ */
+static void TIM_QueueDeferred(uint16_t index)
+{
+    timer_pending[index] = 1;
+
+    if (0 == timer_linked[index])
+    {
+        timer_linked[index] = 1;
+        timer_pending_next[index] = TIM_NOT_QUEUED;
+
+        if (TIM_NOT_QUEUED == timer_pending_tail)
+        {
+            timer_pending_head = index;
+        }
+        else
+        {
+            timer_pending_next[timer_pending_tail] = index;
+        }
+        timer_pending_tail = index;
+    }
+    else
+    {
+        /* Do nothing, callback chưa được dispatch sẽ chỉ chạy một lần */
+    }
+}
+
+/**
+ * @brief Nạp deadline cho một timer và đưa nó vào heap.
+ * @note Gọi khi đã tắt ngắt.
+ */
+static void TIM_Arm(uint16_t index, uint32_t duration_ms, uint8_t periodic)
+{
+    TIM_HeapRemove(index);
+    timer_flag[index] = 0;
+    timer_pending[index] = 0;
+
+    /* Deadline tính từ tick kế tiếp, giống bộ đếm ngược cũ */
+    timer_expiry[index] = TIM_CurrentTick() + duration_ms + 1U;
+    timer_period[index] = (0 != periodic) ? duration_ms : 0;
+    TIM_HeapInsert(index);
+
+#if (TIM_TICKLESS == 1)
+    if (0 == timer_pos[index])
+    {
+        /* Timer mới có deadline sớm nhất */
+        TIM_ProgramAlarm();
+    }
+    else
+    {
+        /* Do nothing */
+    }
+#endif
+}
+
+/**
+ * @brief Kiểm tra handle có thuộc pool và đang được cấp phát hay không.
+ */
+static inline uint8_t TIM_IsValidHandle(TIM_Handle_t handle)
+{
+    return ((handle >= TIM_HANDLE_BASE) && (handle < TIM_TOTAL_TIMERS)
+            && (0 != timer_allocated[handle - TIM_HANDLE_BASE])) ? 1 : 0;
+}
 
 /**
  * @brief Hàm cập nhật cốt lõi cho tất cả software timer.
- * @details Hàm này duyệt qua tất cả các timer, giảm bộ đếm của chúng đi 1.
- * Khi một bộ đếm về 0, cờ báo tương ứng sẽ được bật lên.
+ * @details Chỉ so sánh tick hiện tại với deadline sớm nhất ở gốc heap, nên một tick
+ * không có timer nào hết hạn tốn O(1) bất kể số lượng timer. Mỗi timer hết hạn
+ * được bật cờ; timer định kỳ được nạp lại deadline tuyệt đối và đẩy xuống heap,
+ * timer one-shot bị lấy ra khỏi heap. Sau đó callback được gọi ngay hoặc xếp hàng
+ * cho TIM_Dispatch().
  * @note Hàm này là static và chỉ nên được gọi từ bên trong ISR của hardware timer.
+ * Heap được cập nhật trước khi gọi callback nên callback có thể khởi động lại
+ * hoặc dừng chính timer của nó.
  * @param None
  * @return None
  */
 static void TIM_TimerRun(void)
 {
-    for(uint8_t i = 0; i < MAX_SOFTWARE_TIMERS; i++)
+    uint16_t index = 0;
+
+    while ((timer_heap_size > 0)
+           && ((int32_t)(timer_tick - timer_expiry[timer_heap[0]]) >= 0))
     {
-        if(timer_counter[i] > 0)
+        index = timer_heap[0];
+        timer_flag[index] = 1;
+
+        if (0 != timer_period[index])
         {
-            timer_counter[i]--;
+            timer_expiry[index] += timer_period[index];
+            TIM_HeapSiftDown(0);
         }
         else
         {
-            timer_flag[i] = 1;
+            TIM_HeapRemove(index);
+        }
+
+        if (NULL == timer_callback[index])
+        {
+            /* Do nothing, timer dùng cờ */
+        }
+        else if (0 != timer_deferred[index])
+        {
+            TIM_QueueDeferred(index);
+        }
+        else
+        {
+            timer_callback[index](timer_ctx[index]);
         }
     }
 }
@@ -77,51 +408,69 @@ static void TIM_ClearInterruptFlag(uint8_t channel)
  */
 void TIM_Init(void)
 {
-    /* 1. Cấp clock cho LPIT */
-    IP_PCC->PCCn[PCC_LPIT_INDEX] &= ~PCC_PCCn_CGC_MASK;
-    /* chọn nguồn SPLLDIV2_CLK */
-    IP_PCC->PCCn[PCC_LPIT_INDEX] |= PCC_PCCn_PCS(6);
-    IP_PCC->PCCn[PCC_LPIT_INDEX] |= PCC_PCCn_CGC_MASK;
-
-    /* 2. Reset ngoại vi bằng phần mềm */
-    IP_LPIT0->MCR |= LPIT_MCR_SW_RST_MASK;
-    IP_LPIT0->MCR &= ~LPIT_MCR_SW_RST_MASK;
-
-    /* 3. Bật module LPIT */
-    IP_LPIT0->MCR |= LPIT_MCR_M_CEN_MASK;
+    /*
+     * 1-3. Cấp clock và bật module LPIT qua time_base. Không reset LPIT bằng phần mềm
+     * vì kênh 2 và 3 đang làm bộ đếm thời gian của hệ thống.
+     */
+    time_init();
+    IP_LPIT0->CLRTEN = LPIT_CLRTEN_CLR_T_EN_0_MASK;
+    IP_LPIT0->MSR = LPIT_MSR_TIF0_MASK;
 
     /* 4. Cấu hình kênh 0 của LPIT */
     IP_LPIT0->TMR[0].TCTRL = 0;
     IP_LPIT0->TMR[0].TCTRL |= LPIT_TMR_TCTRL_MODE(0);
     /* SPLLDIV2_CLK là 20MHz */
-    IP_LPIT0->TMR[0].TVAL = 20000 - 1;
+    IP_LPIT0->TMR[0].TVAL = TIM_CYCLES_PER_MS - 1;
     IP_LPIT0->MIER |= LPIT_MIER_TIE0_MASK;
 
     /* 5. Cấu hình chế độ hoạt động khi debug/doze */
     IP_LPIT0->MCR |= LPIT_MCR_DBG_EN_MASK | LPIT_MCR_DOZE_EN_MASK;
 
-    /* 6. Bật ngắt trong NVIC và khởi động timer */
-    NVIC->ISER[LPIT0_Ch0_IRQn / 32] = (1 << (LPIT0_Ch0_IRQn % 32));
-    IP_LPIT0->TMR[0].TCTRL |= LPIT_TMR_TCTRL_T_EN_MASK;
-
-
-    for (uint8_t i = 0;  i < MAX_SOFTWARE_TIMERS; i++)
+    timer_tick = 0;
+    timer_heap_size = 0;
+    timer_pending_head = TIM_NOT_QUEUED;
+    timer_pending_tail = TIM_NOT_QUEUED;
+    for (uint16_t i = 0;  i < TIM_TOTAL_TIMERS; i++)
     {
-        timer_counter[i] = 0;
+        timer_expiry[i] = 0;
+        timer_period[i] = 0;
+        timer_pos[i] = TIM_NOT_QUEUED;
         timer_flag[i] = 0;
+        timer_callback[i] = NULL;
+        timer_ctx[i] = NULL;
+        timer_deferred[i] = 0;
+        timer_linked[i] = 0;
+        timer_pending[i] = 0;
+    }
+
+    /* Cấp phát handle theo thứ tự tăng dần */
+    timer_free_count = TIM_MAX_HANDLES;
+    for (uint16_t i = 0;  i < TIM_MAX_HANDLES; i++)
+    {
+        timer_free_list[i] = (TIM_Handle_t)(TIM_TOTAL_TIMERS - 1U - i);
+        timer_allocated[i] = 0;
     }
 
+    /* 6. Bật ngắt trong NVIC */
+    HAL_IRQ_Enable(LPIT0_Ch0_IRQn);
+
+#if (TIM_TICKLESS == 1)
+    /* Kênh 0 chỉ chạy khi có timer được khởi động */
+#else
+    IP_LPIT0->TMR[0].TCTRL |= LPIT_TMR_TCTRL_T_EN_MASK;
+#endif
+
 }
 
 /**
  * @brief Kiểm tra xem một software timer cụ thể đã hết hạn hay chưa.
  * @copydoc TIM_IsFlag
  */
-uint8_t TIM_IsFlag(uint8_t index)
+uint8_t TIM_IsFlag(uint16_t index)
 {
     if(index >= MAX_SOFTWARE_TIMERS)
     {
-        return 0xFF;
+        return 0;
     }
     else
     {
@@ -137,25 +486,218 @@ uint8_t TIM_IsFlag(uint8_t index)
  * @brief Đặt thời gian và khởi động một software timer.
  * @copydoc TIM_SetTime
  */
-uint8_t TIM_SetTime(uint8_t index, uint32_t duration_ms)
+uint8_t TIM_SetTime(uint16_t index, uint32_t duration_ms)
 {
-    if(index >= MAX_SOFTWARE_TIMERS)
+    return TIM_SetTimeEx(index, duration_ms, TIM_MODE_ONE_SHOT);
+
+}
+
+/**
+ * @brief Khởi động một software timer với chế độ được chọn.
+ * @copydoc TIM_SetTimeEx
+ */
+uint8_t TIM_SetTimeEx(uint16_t index, uint32_t duration_ms, TIM_Mode_t mode)
+{
+    uint32_t irqState = 0;
+
+    if ((index >= MAX_SOFTWARE_TIMERS)
+        || ((TIM_MODE_PERIODIC == mode) && (0 == duration_ms)))
     {
         return 0;
     }
 
-    timer_counter[index] = duration_ms;
-    timer_flag[index] = 0;
+    TIM_ENTER_CRITICAL(irqState);
+    TIM_Arm(index, duration_ms, (TIM_MODE_PERIODIC == mode) ? 1U : 0U);
+    TIM_EXIT_CRITICAL(irqState);
+
+    return 1;
+
+}
+
+/**
+ * @brief Dừng một software timer.
+ * @copydoc TIM_Stop
+ */
+uint8_t TIM_Stop(uint16_t index)
+{
+    uint32_t irqState = 0;
+
+    if (index >= MAX_SOFTWARE_TIMERS)
+    {
+        return 0;
+    }
+
+    TIM_ENTER_CRITICAL(irqState);
+    TIM_HeapRemove(index);
+#if (TIM_TICKLESS == 1)
+    TIM_ProgramAlarm();
+#endif
+    TIM_EXIT_CRITICAL(irqState);
+
+    return 1;
+
+}
+
+/**
+ * @brief Lấy một handle trống từ pool.
+ * @copydoc TIM_Alloc
+ */
+TIM_Handle_t TIM_Alloc(void)
+{
+    TIM_Handle_t handle = TIM_INVALID_HANDLE;
+    uint32_t irqState = 0;
+
+    TIM_ENTER_CRITICAL(irqState);
+
+    if (timer_free_count > 0)
+    {
+        timer_free_count--;
+        handle = timer_free_list[timer_free_count];
+        timer_allocated[handle - TIM_HANDLE_BASE] = 1;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+
+    TIM_EXIT_CRITICAL(irqState);
+
+    return handle;
+
+}
+
+/**
+ * @brief Dừng timer và trả handle về pool.
+ * @copydoc TIM_Free
+ */
+uint8_t TIM_Free(TIM_Handle_t handle)
+{
+    uint32_t irqState = 0;
+
+    TIM_ENTER_CRITICAL(irqState);
+
+    if (0 == TIM_IsValidHandle(handle))
+    {
+        TIM_EXIT_CRITICAL(irqState);
+        return 0;
+    }
+
+    TIM_HeapRemove(handle);
+#if (TIM_TICKLESS == 1)
+    TIM_ProgramAlarm();
+#endif
+
+    /* Handle có thể vẫn nằm trong danh sách chờ, TIM_Dispatch sẽ bỏ qua nó */
+    timer_pending[handle] = 0;
+    timer_callback[handle] = NULL;
+    timer_ctx[handle] = NULL;
+    timer_allocated[handle - TIM_HANDLE_BASE] = 0;
+    timer_free_list[timer_free_count] = handle;
+    timer_free_count++;
+
+    TIM_EXIT_CRITICAL(irqState);
 
     return 1;
 
 }
 
+/**
+ * @brief Khởi động timer của một handle với callback.
+ * @copydoc TIM_Start
+ */
+uint8_t TIM_Start(TIM_Handle_t handle, uint32_t period_ms, TIM_Callback_t callback, void *ctx, uint8_t mode)
+{
+    uint8_t periodic = ((mode & TIM_MODE_PERIODIC) != 0) ? 1U : 0U;
+    uint32_t irqState = 0;
+
+    if ((NULL == callback) || ((0 != periodic) && (0 == period_ms)))
+    {
+        return 0;
+    }
+
+    TIM_ENTER_CRITICAL(irqState);
+
+    if (0 == TIM_IsValidHandle(handle))
+    {
+        TIM_EXIT_CRITICAL(irqState);
+        return 0;
+    }
+
+    timer_callback[handle] = callback;
+    timer_ctx[handle] = ctx;
+    timer_deferred[handle] = ((mode & TIM_MODE_DEFERRED) != 0) ? 1U : 0U;
+    TIM_Arm(handle, period_ms, periodic);
+
+    TIM_EXIT_CRITICAL(irqState);
+
+    return 1;
+
+}
+
+/**
+ * @brief Chạy các callback TIM_MODE_DEFERRED đã hết hạn.
+ * @copydoc TIM_Dispatch
+ */
+uint32_t TIM_Dispatch(void)
+{
+    uint32_t irqState = 0;
+    uint32_t count = 0;
+    uint16_t index = TIM_NOT_QUEUED;
+    uint16_t next = TIM_NOT_QUEUED;
+    TIM_Callback_t callback = NULL;
+    void *ctx = NULL;
+
+    /* Tách toàn bộ danh sách chờ một lần, ISR bắt đầu một danh sách mới */
+    TIM_ENTER_CRITICAL(irqState);
+    index = timer_pending_head;
+    timer_pending_head = TIM_NOT_QUEUED;
+    timer_pending_tail = TIM_NOT_QUEUED;
+    TIM_EXIT_CRITICAL(irqState);
+
+    while (TIM_NOT_QUEUED != index)
+    {
+        TIM_ENTER_CRITICAL(irqState);
+        next = timer_pending_next[index];
+        timer_linked[index] = 0;
+        callback = (0 != timer_pending[index]) ? timer_callback[index] : NULL;
+        ctx = timer_ctx[index];
+        timer_pending[index] = 0;
+        TIM_EXIT_CRITICAL(irqState);
+
+        if (NULL != callback)
+        {
+            callback(ctx);
+            count++;
+        }
+        else
+        {
+            /* Do nothing, timer đã bị dừng hoặc giải phóng */
+        }
+
+        index = next;
+    }
+
+    return count;
+
+}
+
+/**
+ * @brief Đọc số tick (ms) đã trôi qua kể từ khi gọi TIM_Init().
+ * @copydoc TIM_GetTick
+ */
+uint32_t TIM_GetTick(void)
+{
+    /* Chế độ tick: đọc 32-bit là nguyên tử; tickless: tính từ time_base. Không cần tắt ngắt */
+    return TIM_CurrentTick();
+
+}
+
 /**
  * @brief Trình xử lý ngắt cho kênh 0 của LPIT.
  * @details Hàm này được hardware tự động gọi khi timer kênh 0 hết hạn.
  * Nó có nhiệm vụ xóa cờ ngắt phần cứng và gọi hàm cập nhật
- * cho các software timer.
+ * cho các software timer. Ở chế độ tickless, kênh 0 được nạp lại
+ * tới deadline kế tiếp.
  * @param None
  * @return None
  */
@@ -163,6 +705,13 @@ void LPIT0_Ch0_IRQHandler(void)
 {
     TIM_ClearInterruptFlag(0);
 
+#if (TIM_TICKLESS == 1)
+    timer_tick = TIM_CurrentTick();
+    TIM_TimerRun();
+    TIM_ProgramAlarm();
+#else
+    timer_tick++;
     TIM_TimerRun();
+#endif
 
 }
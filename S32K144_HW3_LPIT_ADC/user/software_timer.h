@@ -13,16 +13,72 @@
 #define SOFTWARE_TIMER_H_
 
 #include "stdint.h"
-#include "my_nvic.h"
+#include "stddef.h"
+#include "hal_irq.h"
 #include "S32K144.h"
+#include "time_base.h"
 
+/**
+ * @brief Số lượng software timer, có thể định nghĩa lại khi biên dịch (tối đa 65534).
+ * @note Chi phí ngắt tick không phụ thuộc vào số timer: ISR chỉ so sánh tick hiện tại
+ * với deadline sớm nhất, mỗi timer hết hạn tốn O(log N).
+ */
+#ifndef MAX_SOFTWARE_TIMERS
 #define MAX_SOFTWARE_TIMERS   10
+#endif
+
+/**
+ * @brief Số handle trong pool dành cho các timer có callback (TIM_Alloc/TIM_Start).
+ * @note Handle được đánh số tiếp sau các timer dùng cờ, tổng số không vượt quá 65534.
+ */
+#ifndef TIM_MAX_HANDLES
+#define TIM_MAX_HANDLES       16
+#endif
+
+#define TIM_INVALID_HANDLE    0xFFFFU
+
+/**
+ * @brief Chế độ tickless.
+ * @note 1: kênh 0 của LPIT chỉ được nạp để ngắt đúng vào deadline sớm nhất, hệ thống
+ * rảnh gần như không có ngắt. 0: ngắt tick định kỳ mỗi 1ms như trước.
+ * Trong cả hai chế độ, thời gian được đo bằng bộ đếm 64-bit của time_base.
+ */
+#ifndef TIM_TICKLESS
+#define TIM_TICKLESS            1
+#endif
+
+/**
+ * @brief Số chu kỳ clock LPIT trong 1ms.
+ */
+#define TIM_CYCLES_PER_MS       (TIME_LPIT_CLOCK_HZ / 1000UL)
+
+/**
+ * @brief Chế độ hoạt động của một software timer.
+ * @note Với TIM_Start(), chọn một trong hai chế độ đếm và có thể kết hợp (|)
+ * với TIM_MODE_DEFERRED.
+ */
+typedef enum
+{
+    TIM_MODE_ONE_SHOT = 0x00,   /* Hết hạn một lần rồi dừng */
+    TIM_MODE_PERIODIC = 0x01,   /* Tự nạp lại, deadline kế tiếp = deadline cũ + chu kỳ */
+    TIM_MODE_DEFERRED = 0x02    /* Callback chạy trong TIM_Dispatch() thay vì trong ISR */
+} TIM_Mode_t;
+
+/**
+ * @brief Handle của một timer lấy từ pool bằng TIM_Alloc().
+ */
+typedef uint16_t TIM_Handle_t;
+
+/**
+ * @brief Hàm được gọi khi timer hết hạn, ctx là con trỏ truyền vào TIM_Start().
+ */
+typedef void (*TIM_Callback_t)(void *ctx);
 
 /**
  * @brief Khởi tạo module hardware timer
- * @note Hàm này cấu hình hardware timer để tạo ra một ngắt định kỳ (tick),
- * thường là mỗi 1ms. Nó phải được gọi một lần duy nhất trước khi sử dụng
- * bất kỳ hàm timer nào khác.
+ * @note Hàm này cấu hình hardware timer để tạo ra một ngắt định kỳ (tick) mỗi 1ms,
+ * hoặc ở chế độ tickless chỉ ngắt tại deadline sớm nhất. Nó phải được gọi một lần
+ * duy nhất trước khi sử dụng bất kỳ hàm timer nào khác.
  * @param None
  * @return None
  */
@@ -35,21 +91,98 @@ void TIM_Init(void);
  * @param[in] index Chỉ số của software timer cần kiểm tra (từ 0 đến MAX_SOFTWARE_TIMERS - 1).
  * @return uint8_t
  * - 1: Nếu timer đã hết hạn.
- * - 0: Nếu timer vẫn đang chạy.
+ * - 0: Nếu timer vẫn đang chạy hoặc chỉ số (index) không hợp lệ.
  */
-uint8_t TIM_IsFlag(uint8_t index);
+uint8_t TIM_IsFlag(uint16_t index);
 
 /**
- * @brief Đặt thời gian và khởi động một software timer.
+ * @brief Đặt thời gian và khởi động một software timer ở chế độ một lần (one-shot).
  * @note Hàm này thiết lập giá trị đếm ngược cho timer được chỉ định. Timer sẽ
  * bắt đầu chạy ngay lập tức. Dùng hàm TIM_IsFlag() để kiểm tra khi nào nó hết hạn.
  * @param[in] index Chỉ số của software timer cần đặt (từ 0 đến MAX_SOFTWARE_TIMERS - 1).
  * @param[in] duration_ms Thời gian đếm mong muốn, tính bằng mili-giây (ms).
  * @return uint8_t
- * - 0: Nếu cài đặt thành công.
- * - 1: Nếu chỉ số (index) không hợp lệ.
+ * - 1: Nếu cài đặt thành công.
+ * - 0: Nếu chỉ số (index) không hợp lệ.
+ */
+uint8_t TIM_SetTime(uint16_t index, uint32_t duration_ms);
+
+/**
+ * @brief Khởi động một software timer với chế độ được chọn.
+ * @note Nếu timer đang chạy, nó được khởi động lại với thời gian mới.
+ * Ở chế độ TIM_MODE_PERIODIC, cờ được bật lại sau mỗi chu kỳ mà không trôi.
+ * @param[in] index Chỉ số của software timer (từ 0 đến MAX_SOFTWARE_TIMERS - 1).
+ * @param[in] duration_ms Thời gian (ms) đến lần hết hạn đầu tiên, cũng là chu kỳ
+ * ở chế độ định kỳ. Với chế độ định kỳ phải lớn hơn 0.
+ * @param[in] mode TIM_MODE_ONE_SHOT hoặc TIM_MODE_PERIODIC.
+ * @return uint8_t
+ * - 1: Nếu cài đặt thành công.
+ * - 0: Nếu tham số không hợp lệ.
+ */
+uint8_t TIM_SetTimeEx(uint16_t index, uint32_t duration_ms, TIM_Mode_t mode);
+
+/**
+ * @brief Dừng một software timer, cờ đã bật trước đó vẫn được giữ.
+ * @param[in] index Chỉ số của software timer (từ 0 đến MAX_SOFTWARE_TIMERS - 1).
+ * @return uint8_t
+ * - 1: Nếu thành công.
+ * - 0: Nếu chỉ số (index) không hợp lệ.
+ */
+uint8_t TIM_Stop(uint16_t index);
+
+/**
+ * @brief Lấy một handle trống từ pool.
+ * @param None
+ * @return TIM_Handle_t Handle mới, TIM_INVALID_HANDLE nếu pool đã hết.
+ */
+TIM_Handle_t TIM_Alloc(void);
+
+/**
+ * @brief Dừng timer và trả handle về pool, callback đang chờ dispatch bị hủy.
+ * @param[in] handle Handle lấy từ TIM_Alloc().
+ * @return uint8_t
+ * - 1: Nếu thành công.
+ * - 0: Nếu handle không hợp lệ.
+ */
+uint8_t TIM_Free(TIM_Handle_t handle);
+
+/**
+ * @brief Khởi động timer của một handle với callback.
+ * @note Nếu timer đang chạy, nó được khởi động lại. Mặc định callback chạy ngay
+ * trong ISR (jitter nhỏ nhất, phải ngắn và không chặn). Với TIM_MODE_DEFERRED,
+ * callback được xếp hàng và chạy ở lần gọi TIM_Dispatch() kế tiếp.
+ * @param[in] handle Handle lấy từ TIM_Alloc().
+ * @param[in] period_ms Thời gian (ms) đến lần hết hạn đầu tiên, cũng là chu kỳ ở
+ * chế độ định kỳ.
+ * @param[in] callback Hàm được gọi khi hết hạn.
+ * @param[in] ctx Tham số truyền cho callback.
+ * @param[in] mode TIM_MODE_ONE_SHOT hoặc TIM_MODE_PERIODIC, có thể kết hợp TIM_MODE_DEFERRED.
+ * @return uint8_t
+ * - 1: Nếu thành công.
+ * - 0: Nếu tham số không hợp lệ.
+ */
+uint8_t TIM_Start(TIM_Handle_t handle, uint32_t period_ms, TIM_Callback_t callback, void *ctx, uint8_t mode);
+
+/**
+ * @brief Chạy các callback TIM_MODE_DEFERRED đã hết hạn.
+ * @note Gọi trong vòng lặp chính. Toàn bộ danh sách chờ được tách ra một lần nên mọi
+ * callback hết hạn trong cùng tick được chạy trong cùng một lượt, theo thứ tự hết hạn.
+ * Một timer định kỳ hết hạn nhiều lần trước khi được dispatch chỉ chạy callback một lần.
+ * @param None
+ * @return uint32_t Số callback đã chạy.
+ */
+uint32_t TIM_Dispatch(void);
+
+/**
+ * @brief Đọc số tick (ms) đã trôi qua.
+ * @note Ở chế độ tick, tick đếm từ TIM_Init(); ở chế độ tickless, tick được tính
+ * từ bộ đếm của time_base, tức là từ time_init().
+ * @note Bộ đếm 32-bit tràn sau khoảng 49 ngày, khi so sánh hai mốc thời gian
+ * cần dùng phép trừ có dấu (int32_t)(a - b) để không bị ảnh hưởng bởi tràn số.
+ * @param None
+ * @return uint32_t Số tick hiện tại.
  */
-uint8_t TIM_SetTime(uint8_t index, uint32_t duration_ms);
+uint32_t TIM_GetTick(void);
 
 
 #endif /* SOFTWARE_TIMER_H_ */
@@ -0,0 +1,76 @@
+/**
+ * @file time_base.c
+ * @brief File triển khai bộ đếm thời gian 64-bit.
+ * @details Hai kênh LPIT đếm xuống từ 0xFFFFFFFF, kênh cao nối chuỗi nên chỉ giảm
+ * khi kênh thấp hết một vòng. Số chu kỳ đã trôi qua là phần bù của giá trị hiện tại.
+ *
+ * @author Nguyen Vuong Trung Nam
+ * @date Oct 17, 2026
+ */
+
+#include "time_base.h"
+
+/**
+ * @brief Khởi động bộ đếm thời gian.
+ * @copydoc time_init
+ */
+void time_init(void)
+{
+    if (IP_LPIT0->TMR[TIME_HIGH_CHANNEL].TCTRL & LPIT_TMR_TCTRL_T_EN_MASK)
+    {
+        /* Bộ đếm đã chạy */
+        return;
+    }
+
+    /* 1. Cấp clock cho LPIT, chỉ chọn nguồn SPLLDIV2_CLK khi clock gate còn tắt */
+    if (0 == (IP_PCC->PCCn[PCC_LPIT_INDEX] & PCC_PCCn_CGC_MASK))
+    {
+        IP_PCC->PCCn[PCC_LPIT_INDEX] = PCC_PCCn_PCS(6);
+        IP_PCC->PCCn[PCC_LPIT_INDEX] |= PCC_PCCn_CGC_MASK;
+    }
+
+    /* 2. Bật module LPIT, tiếp tục đếm khi debug/doze */
+    IP_LPIT0->MCR |= LPIT_MCR_M_CEN_MASK | LPIT_MCR_DBG_EN_MASK | LPIT_MCR_DOZE_EN_MASK;
+
+    /* 3. Kênh thấp đếm chu kỳ clock, kênh cao nối chuỗi, không bật ngắt */
+    IP_LPIT0->TMR[TIME_LOW_CHANNEL].TCTRL = LPIT_TMR_TCTRL_MODE(0);
+    IP_LPIT0->TMR[TIME_LOW_CHANNEL].TVAL = 0xFFFFFFFFUL;
+    IP_LPIT0->TMR[TIME_HIGH_CHANNEL].TCTRL = LPIT_TMR_TCTRL_MODE(0) | LPIT_TMR_TCTRL_CHAIN_MASK;
+    IP_LPIT0->TMR[TIME_HIGH_CHANNEL].TVAL = 0xFFFFFFFFUL;
+
+    /* 4. Khởi động cả hai kênh cùng lúc */
+    IP_LPIT0->SETTEN = LPIT_SETTEN_SET_T_EN_2_MASK | LPIT_SETTEN_SET_T_EN_3_MASK;
+
+}
+
+/**
+ * @brief Đọc số chu kỳ clock LPIT đã trôi qua.
+ * @copydoc time_now_cycles
+ */
+uint64_t time_now_cycles(void)
+{
+    uint32_t high = 0;
+    uint32_t low = 0;
+    uint32_t check = IP_LPIT0->TMR[TIME_HIGH_CHANNEL].CVAL;
+
+    /* Đọc lại phần cao cho đến khi không đổi trong lúc đọc phần thấp */
+    do
+    {
+        high = check;
+        low = IP_LPIT0->TMR[TIME_LOW_CHANNEL].CVAL;
+        check = IP_LPIT0->TMR[TIME_HIGH_CHANNEL].CVAL;
+    } while (high != check);
+
+    return ((uint64_t)(~high) << 32) | (uint64_t)(~low);
+
+}
+
+/**
+ * @brief Đọc số micro-giây đã trôi qua.
+ * @copydoc time_now_us
+ */
+uint64_t time_now_us(void)
+{
+    return time_now_cycles() / TIME_CYCLES_PER_US;
+
+}
@@ -0,0 +1,55 @@
+/**
+ * @file time_base.h
+ * @brief Cung cấp mốc thời gian đơn điệu ("now") cho toàn hệ thống.
+ * @details Bộ đếm 64-bit được ghép từ kênh 2 và 3 của LPIT nối chuỗi (chain), đếm
+ * theo clock chức năng của LPIT (SPLLDIV2_CLK = 20MHz) nên không bao giờ tràn
+ * trong thực tế. Việc đọc không cần tắt ngắt: phần cao được đọc lại để phát hiện
+ * lúc phần thấp vừa tràn.
+ *
+ * @author Nguyen Vuong Trung Nam
+ * @date Oct 17, 2026
+ */
+
+#ifndef TIME_BASE_H_
+#define TIME_BASE_H_
+
+#include "stdint.h"
+#include "S32K144.h"
+
+/**
+ * @brief Tần số clock chức năng của LPIT (SPLLDIV2_CLK) và số chu kỳ trong 1us.
+ */
+#define TIME_LPIT_CLOCK_HZ      20000000UL
+#define TIME_CYCLES_PER_US      (TIME_LPIT_CLOCK_HZ / 1000000UL)
+
+/**
+ * @brief Kênh LPIT dùng cho bộ đếm: kênh thấp đếm chu kỳ clock, kênh cao đếm số lần kênh thấp tràn.
+ */
+#define TIME_LOW_CHANNEL        2U
+#define TIME_HIGH_CHANNEL       3U
+
+/**
+ * @brief Khởi động bộ đếm thời gian.
+ * @note Nếu bộ đếm đã chạy thì hàm không làm gì, nên mọi module cần "now"
+ * (software timer, ADC, ứng dụng) đều có thể gọi trong hàm khởi tạo của mình.
+ * Hàm không reset LPIT để không ảnh hưởng các kênh đang được dùng.
+ * @param None
+ * @return None
+ */
+void time_init(void);
+
+/**
+ * @brief Đọc số chu kỳ clock LPIT đã trôi qua kể từ time_init().
+ * @param None
+ * @return uint64_t Số chu kỳ (TIME_LPIT_CLOCK_HZ).
+ */
+uint64_t time_now_cycles(void);
+
+/**
+ * @brief Đọc số micro-giây đã trôi qua kể từ time_init().
+ * @param None
+ * @return uint64_t Số micro-giây.
+ */
+uint64_t time_now_us(void);
+
+#endif /* TIME_BASE_H_ */